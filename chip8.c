@@ -2,14 +2,14 @@
 #include "chip8_impl.h"
 #include "chip8_cpu.h"
 #include "chip8_opcodes.h"
+#include <stddef.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
-/* opcode that was executed on chip before this one(for debugging purposes) */
-static unsigned short latest_opcode = 0;
-/* parameters for currently executed opcode */
-static opcode_params_t params;
+/* receives a frame on every timer tick */
+static chip8_frame_callback_t frame_callback = NULL;
+static void* frame_userdata = NULL;
 
 /* chip8 fontset which is loaded in memory */
 unsigned char chip8_fontset[80] =
@@ -56,6 +56,8 @@ void chip8_init(chip8_t* chip){
 	chip->sound_timer = 0;
 	/* disable "waiting for keypress" status */
 	chip->waiting_keypress = 0;
+	/* every run gets the same random numbers, like rand() without srand() */
+	chip->random = 1;
 	/* load default fontset into memory */
 	chip8_load_fonts(chip);
 }
@@ -73,16 +75,36 @@ void load_params(unsigned short opcode, opcode_params_t* out){
 	out->n = 	opcode & 0x000F;
 }
 
+/* the generator from the C standard's rand() example */
+unsigned short chip8_random(chip8_t* chip){
+	chip->random = (chip->random * 1103515245UL + 12345) & 0xFFFFFFFFUL;
+	return (chip->random >> 16) & 0x7FFF;
+}
+
 /* makes timers tick */
 void chip8_update_timers(chip8_t* chip){
 	if(chip->delay_timer > 0)
 		chip->delay_timer -= 1;
 	if(chip->sound_timer > 0)
 		chip->sound_timer -= 1;
+	/* timers tick at 60 Hz, so this is where a frame ends */
+	if(frame_callback != NULL)
+		frame_callback(chip, frame_userdata);
+}
+
+void chip8_set_frame_callback(chip8_frame_callback_t callback, void* userdata){
+	frame_callback = callback;
+	frame_userdata = userdata;
+}
+
+chip8_frame_callback_t chip8_get_frame_callback(void){
+	return frame_callback;
 }
 
 /* performs one CPU cycle */
 void chip8_cycle(chip8_t* chip){
+	/* parameters for currently executed opcode - not static, machines may run in several threads */
+	opcode_params_t params;
 	/* if we're waiting for keypress, CPU is interrupted and nothing happens */
 	if(chip->waiting_keypress == 1){
 		return;
@@ -95,8 +117,6 @@ void chip8_cycle(chip8_t* chip){
 	unsigned short raw_opcode;
 	memcpy(&raw_opcode, chip->memory + chip->pc, sizeof(unsigned short));
 
-	printf("PC before: %hx\n", chip->pc);
-
 	/* move to next instruction */
 	chip->pc += sizeof(unsigned short);
 	/* switch opcode endianness */
@@ -108,12 +128,24 @@ void chip8_cycle(chip8_t* chip){
 	/* execute opcode (chip8_cpu.c) */
 	chip8_execute_opcode(chip, &params);
 
-	printf("PC after: %hx\n", chip->pc);
-
 	/* tick timers */
 	chip8_update_timers(chip);
-	/* remember the latest opcode(for debugging purposes) */
-	latest_opcode = chip->opcode;
+}
+
+/* the state has no pointers, so a plain copy is a complete snapshot */
+void chip8_save(const chip8_t* chip, chip8_snapshot_t* snapshot){
+	*snapshot = *chip;
+}
+
+void chip8_restore(chip8_t* chip, const chip8_snapshot_t* snapshot){
+	*chip = *snapshot;
+}
+
+/* memory is most of the machine, the rest is copied around it whatever the order of the fields */
+void chip8_copy_state(chip8_t* to, const chip8_t* from){
+	size_t lo = offsetof(chip8_t, memory), hi = lo + sizeof(from->memory);
+	memcpy(to, from, lo);
+	memcpy((unsigned char*)to + hi, (const unsigned char*)from + hi, sizeof(chip8_t) - hi);
 }
 
 void chip8_cleanup(chip8_t* chip){
@@ -5,6 +5,11 @@
 #define CHIP_PROGRAM_OFFSET	0x200
 #define CHIP_FONTS_OFFSET	0x0
 #define CHIP_MEMORY_SIZE 	4096
+/* I and pc are 16 bit, so memory covers every address they can hold.
+ * programs normally live in the first CHIP_MEMORY_SIZE bytes */
+#define CHIP_ADDRESS_SPACE	0x10000
+/* instructions access at most 16 bytes starting at I (Dxyn, Fx55, Fx65) */
+#define CHIP_ADDRESS_GUARD	16
 #define CHIP_GFX_WIDTH 		64
 #define CHIP_GFX_HEIGHT 	32
 #define CHIP_REGISTER_COUNT 	16
@@ -12,8 +17,8 @@
 #define CHIP_KEYS_COUNT		16
 
 typedef struct {
-	/* memory array */
-	unsigned char memory[CHIP_MEMORY_SIZE];
+	/* memory array - any I + offset an instruction can produce is inside, so handlers don't check bounds */
+	unsigned char memory[CHIP_ADDRESS_SPACE + CHIP_ADDRESS_GUARD];
 	/* registers - V0 - VF */
 	unsigned char V[CHIP_REGISTER_COUNT];
 	/* index register */
@@ -38,6 +43,8 @@ typedef struct {
 	unsigned char waiting_keypress;
 	/* the key that was pressed last time */
 	unsigned char last_pressed;
+	/* random number generator state, part of the machine so that snapshots replay the same numbers */
+	unsigned long random;
 } chip8_t;
 
 typedef struct {
@@ -46,6 +53,12 @@ typedef struct {
 	unsigned short n, x, y;
 } opcode_params_t;
 
+/* saved state of a machine, restoring it rewinds the machine to the moment it was saved */
+typedef chip8_t chip8_snapshot_t;
+
+/* receives the machine at the end of every frame */
+typedef void (*chip8_frame_callback_t)(chip8_t* chip, void* userdata);
+
 /* initializes the machine */
 void chip8_init(chip8_t* chip);
 
@@ -55,6 +68,27 @@ void chip8_load(chip8_t* chip, unsigned char* program, size_t program_length);
 /* perform one cycle */
 void chip8_cycle(chip8_t* chip);
 
+/* makes timers tick - this ends a frame */
+void chip8_update_timers(chip8_t* chip);
+
+/* sets function which is called on every timer tick (60 Hz), NULL disables it */
+void chip8_set_frame_callback(chip8_frame_callback_t callback, void* userdata);
+
+/* returns the current frame callback */
+chip8_frame_callback_t chip8_get_frame_callback(void);
+
+/* next random number (0 .. 32767) of the machine */
+unsigned short chip8_random(chip8_t* chip);
+
+/* saves the whole machine state */
+void chip8_save(const chip8_t* chip, chip8_snapshot_t* snapshot);
+
+/* puts the machine back into a saved state */
+void chip8_restore(chip8_t* chip, const chip8_snapshot_t* snapshot);
+
+/* copies everything except memory - registers, stack, screen, timers and keys */
+void chip8_copy_state(chip8_t* to, const chip8_t* from);
+
 /* cleans up the struct */
 void chip8_cleanup(chip8_t* chip);
 #endif
@@ -0,0 +1,328 @@
+#define _POSIX_C_SOURCE 200112L
+#include "chip8_capture.h"
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Y4M luma of a lit / dark pixel - same colors as chipm8 (black on white) */
+#define Y4M_ON		16
+#define Y4M_OFF		235
+
+typedef struct {
+	unsigned char pixels[CHIP8_CAPTURE_FRAME_SIZE];
+	unsigned long repeat;
+} frame_t;
+
+struct chip8_capture {
+	int format;
+	FILE* file;
+	/* list of PNG files (CHIP8_CAPTURE_PNG) */
+	FILE* list;
+	char* path;
+	unsigned long png_count;
+
+	/* frame which keeps repeating, not queued yet */
+	frame_t pending;
+	unsigned long pending_hash;
+	int has_pending;
+
+	/* ring buffer between the machine and the writer */
+	frame_t* queue;
+	size_t queue_length;
+	size_t head, count;
+	int closing;
+	pthread_mutex_t lock;
+	pthread_cond_t wakeup;
+	pthread_t writer;
+
+	chip8_capture_stats_t stats;
+};
+
+/* packs gfx to 1 bit per pixel */
+static void pack(chip8_t* chip, unsigned char* out){
+	int i;
+	memset(out, 0, CHIP8_CAPTURE_FRAME_SIZE);
+	for(i = 0; i < CHIP_GFX_WIDTH * CHIP_GFX_HEIGHT; ++i){
+		if(chip->gfx[i])
+			out[i / 8] |= 0x80 >> (i % 8);
+	}
+}
+
+/* FNV-1a */
+static unsigned long hash(const unsigned char* data, size_t length){
+	unsigned long h = 2166136261UL;
+	size_t i;
+	for(i = 0; i < length; ++i){
+		h ^= data[i];
+		h = (h * 16777619UL) & 0xFFFFFFFFUL;
+	}
+	return h;
+}
+
+static unsigned long crc_table[256];
+
+static void make_crc_table(void){
+	unsigned long c;
+	int n, k;
+	for(n = 0; n < 256; ++n){
+		c = (unsigned long)n;
+		for(k = 0; k < 8; ++k)
+			c = (c & 1) ? 0xEDB88320UL ^ (c >> 1) : c >> 1;
+		crc_table[n] = c;
+	}
+}
+
+static unsigned long crc(unsigned long c, const unsigned char* data, size_t length){
+	size_t i;
+	for(i = 0; i < length; ++i)
+		c = crc_table[(c ^ data[i]) & 0xFF] ^ (c >> 8);
+	return c;
+}
+
+static void put32(unsigned char* out, unsigned long value){
+	out[0] = (value >> 24) & 0xFF;
+	out[1] = (value >> 16) & 0xFF;
+	out[2] = (value >> 8) & 0xFF;
+	out[3] = value & 0xFF;
+}
+
+static void write_chunk(FILE* file, const char* type, const unsigned char* data, size_t length){
+	unsigned char header[8], footer[4];
+	put32(header, length);
+	memcpy(header + 4, type, 4);
+	put32(footer, crc(crc(0xFFFFFFFFUL, header + 4, 4), data, length) ^ 0xFFFFFFFFUL);
+	fwrite(header, 1, sizeof(header), file);
+	fwrite(data, 1, length, file);
+	fwrite(footer, 1, sizeof(footer), file);
+}
+
+/* 1-bit grayscale PNG, the image data is a single stored (uncompressed) deflate block */
+static void write_png(FILE* file, const unsigned char* pixels){
+	static const unsigned char signature[8] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+	enum { ROW = CHIP_GFX_WIDTH / 8 + 1, RAW = ROW * CHIP_GFX_HEIGHT };
+	unsigned char ihdr[13], idat[2 + 5 + RAW + 4];
+	unsigned long a = 1, b = 0;
+	int x, y;
+
+	put32(ihdr, CHIP_GFX_WIDTH);
+	put32(ihdr + 4, CHIP_GFX_HEIGHT);
+	ihdr[8] = 1;	/* bit depth */
+	ihdr[9] = 0;	/* grayscale */
+	ihdr[10] = ihdr[11] = ihdr[12] = 0;
+
+	idat[0] = 0x78;
+	idat[1] = 0x01;
+	idat[2] = 0x01;	/* final stored block */
+	idat[3] = RAW & 0xFF;
+	idat[4] = RAW >> 8;
+	idat[5] = ~RAW & 0xFF;
+	idat[6] = (~RAW >> 8) & 0xFF;
+	for(y = 0; y < CHIP_GFX_HEIGHT; ++y){
+		idat[7 + y * ROW] = 0;	/* no filter */
+		for(x = 0; x < ROW - 1; ++x){
+			/* 0 is black in PNG, but a lit pixel is black on the screen */
+			idat[7 + y * ROW + 1 + x] = ~pixels[y * (ROW - 1) + x];
+		}
+	}
+	for(x = 0; x < RAW; ++x){
+		a = (a + idat[7 + x]) % 65521;
+		b = (b + a) % 65521;
+	}
+	put32(idat + 7 + RAW, (b << 16) | a);
+
+	fwrite(signature, 1, sizeof(signature), file);
+	write_chunk(file, "IHDR", ihdr, sizeof(ihdr));
+	write_chunk(file, "IDAT", idat, sizeof(idat));
+	write_chunk(file, "IEND", NULL, 0);
+}
+
+static void write_frame(chip8_capture_t* capture, frame_t* frame){
+	unsigned char y4m[CHIP_GFX_WIDTH * CHIP_GFX_HEIGHT];
+	unsigned char repeat[4];
+	unsigned long i;
+	char name[1024];
+	FILE* png;
+	const char* base;
+
+	switch(capture->format){
+	case CHIP8_CAPTURE_Y4M:
+		for(i = 0; i < sizeof(y4m); ++i)
+			y4m[i] = (frame->pixels[i / 8] & (0x80 >> (i % 8))) ? Y4M_ON : Y4M_OFF;
+		for(i = 0; i < frame->repeat; ++i){
+			fputs("FRAME\n", capture->file);
+			fwrite(y4m, 1, sizeof(y4m), capture->file);
+		}
+		break;
+	case CHIP8_CAPTURE_RAW:
+		/* little endian repeat count */
+		repeat[0] = frame->repeat & 0xFF;
+		repeat[1] = (frame->repeat >> 8) & 0xFF;
+		repeat[2] = (frame->repeat >> 16) & 0xFF;
+		repeat[3] = (frame->repeat >> 24) & 0xFF;
+		fwrite(repeat, 1, sizeof(repeat), capture->file);
+		fwrite(frame->pixels, 1, sizeof(frame->pixels), capture->file);
+		break;
+	case CHIP8_CAPTURE_PNG:
+		sprintf(name, "%.1000s-%06lu.png", capture->path, ++capture->png_count);
+		png = fopen(name, "wb");
+		if(png == NULL){
+			fprintf(stderr, "Error: Unable to open %s\n", name);
+			break;
+		}
+		write_png(png, frame->pixels);
+		fclose(png);
+		/* the list refers to files relative to itself */
+		base = strrchr(name, '/');
+		fprintf(capture->list, "file '%s'\nduration %.6f\n", base ? base + 1 : name, frame->repeat / 60.0);
+		break;
+	}
+}
+
+static void* writer_main(void* userdata){
+	chip8_capture_t* capture = userdata;
+	frame_t frame;
+
+	pthread_mutex_lock(&capture->lock);
+	for(;;){
+		while(capture->count == 0 && !capture->closing)
+			pthread_cond_wait(&capture->wakeup, &capture->lock);
+		if(capture->count == 0)
+			break;
+		frame = capture->queue[capture->head];
+		capture->head = (capture->head + 1) % capture->queue_length;
+		--capture->count;
+		/* write without holding the lock, the machine may queue meanwhile */
+		pthread_mutex_unlock(&capture->lock);
+		write_frame(capture, &frame);
+		pthread_mutex_lock(&capture->lock);
+	}
+	pthread_mutex_unlock(&capture->lock);
+	return NULL;
+}
+
+/* hands the pending frame over to the writer */
+static void flush_pending(chip8_capture_t* capture){
+	pthread_mutex_lock(&capture->lock);
+	capture->queue[(capture->head + capture->count) % capture->queue_length] = capture->pending;
+	++capture->count;
+	pthread_cond_signal(&capture->wakeup);
+	pthread_mutex_unlock(&capture->lock);
+	++capture->stats.distinct;
+}
+
+static int queue_full(chip8_capture_t* capture){
+	int full;
+	pthread_mutex_lock(&capture->lock);
+	full = capture->count == capture->queue_length;
+	pthread_mutex_unlock(&capture->lock);
+	return full;
+}
+
+chip8_capture_t* chip8_capture_open(const char* path, int format, size_t queue_length){
+	chip8_capture_t* capture = calloc(1, sizeof(chip8_capture_t));
+	char* list_path;
+
+	if(capture == NULL)
+		return NULL;
+	capture->format = format;
+	capture->queue_length = queue_length > 0 ? queue_length : CHIP8_CAPTURE_QUEUE_LENGTH;
+	capture->queue = malloc(capture->queue_length * sizeof(frame_t));
+	capture->path = malloc(strlen(path) + 5);
+	if(capture->queue == NULL || capture->path == NULL)
+		goto fail;
+	strcpy(capture->path, path);
+
+	if(format == CHIP8_CAPTURE_PNG){
+		list_path = capture->path;
+		strcat(list_path, ".txt");
+		capture->list = fopen(list_path, "w");
+		list_path[strlen(path)] = '\0';
+		if(capture->list == NULL)
+			goto fail;
+		fputs("ffconcat version 1.0\n", capture->list);
+		make_crc_table();
+	} else {
+		capture->file = fopen(path, "wb");
+		if(capture->file == NULL)
+			goto fail;
+		if(format == CHIP8_CAPTURE_Y4M)
+			fprintf(capture->file, "YUV4MPEG2 W%d H%d F60:1 Ip A1:1 Cmono\n", CHIP_GFX_WIDTH, CHIP_GFX_HEIGHT);
+		else
+			fputs("C8RAW\n", capture->file);
+	}
+
+	pthread_mutex_init(&capture->lock, NULL);
+	pthread_cond_init(&capture->wakeup, NULL);
+	if(pthread_create(&capture->writer, NULL, writer_main, capture) != 0){
+		pthread_cond_destroy(&capture->wakeup);
+		pthread_mutex_destroy(&capture->lock);
+		goto fail;
+	}
+	return capture;
+
+fail:
+	if(capture->file != NULL)
+		fclose(capture->file);
+	if(capture->list != NULL)
+		fclose(capture->list);
+	free(capture->path);
+	free(capture->queue);
+	free(capture);
+	return NULL;
+}
+
+void chip8_capture_frame(chip8_t* chip, void* userdata){
+	chip8_capture_t* capture = userdata;
+	unsigned char pixels[CHIP8_CAPTURE_FRAME_SIZE];
+	unsigned long h;
+
+	++capture->stats.frames;
+	pack(chip, pixels);
+	h = hash(pixels, sizeof(pixels));
+	if(capture->has_pending && h == capture->pending_hash
+			&& memcmp(pixels, capture->pending.pixels, sizeof(pixels)) == 0){
+		++capture->pending.repeat;
+		return;
+	}
+	if(capture->has_pending){
+		if(queue_full(capture)){
+			/* never wait for the writer - hold the previous picture instead */
+			++capture->pending.repeat;
+			++capture->stats.dropped;
+			return;
+		}
+		flush_pending(capture);
+	}
+	memcpy(capture->pending.pixels, pixels, sizeof(pixels));
+	capture->pending.repeat = 1;
+	capture->pending_hash = h;
+	capture->has_pending = 1;
+}
+
+void chip8_capture_close(chip8_capture_t* capture, chip8_capture_stats_t* stats){
+	if(capture->has_pending){
+		/* at the end it's fine to wait */
+		while(queue_full(capture))
+			sched_yield();
+		flush_pending(capture);
+	}
+	pthread_mutex_lock(&capture->lock);
+	capture->closing = 1;
+	pthread_cond_signal(&capture->wakeup);
+	pthread_mutex_unlock(&capture->lock);
+	pthread_join(capture->writer, NULL);
+
+	pthread_cond_destroy(&capture->wakeup);
+	pthread_mutex_destroy(&capture->lock);
+	if(capture->file != NULL)
+		fclose(capture->file);
+	if(capture->list != NULL)
+		fclose(capture->list);
+	if(stats != NULL)
+		*stats = capture->stats;
+	free(capture->path);
+	free(capture->queue);
+	free(capture);
+}
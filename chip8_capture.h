@@ -0,0 +1,54 @@
+#ifndef __CHIP8_CAPTURE_H__
+#define __CHIP8_CAPTURE_H__
+
+#include "chip8.h"
+
+/*
+ * Headless video capture.
+ *
+ * Frames are handed over at the end of every frame (see chip8_set_frame_callback)
+ * and written by a background thread. The queue between them is bounded and
+ * the emulator never waits for the writer - if the queue is full, the frame is
+ * counted as dropped and the previous picture is held for it instead.
+ *
+ * Consecutive identical frames are detected by hashing chip->gfx and are queued
+ * once with a repeat count:
+ *	CHIP8_CAPTURE_Y4M - YUV4MPEG2 stream, repeats are written out as frames
+ *	CHIP8_CAPTURE_RAW - "C8RAW" stream of records (repeat count + packed frame)
+ *	CHIP8_CAPTURE_PNG - one PNG per distinct frame + ffconcat list with durations
+ */
+
+#define CHIP8_CAPTURE_Y4M	0
+#define CHIP8_CAPTURE_RAW	1
+#define CHIP8_CAPTURE_PNG	2
+
+/* frames which fit into the queue by default */
+#define CHIP8_CAPTURE_QUEUE_LENGTH	256
+
+/* one frame, 1 bit per pixel, rows from top, most significant bit is the leftmost pixel */
+#define CHIP8_CAPTURE_FRAME_SIZE	(CHIP_GFX_WIDTH * CHIP_GFX_HEIGHT / 8)
+
+typedef struct chip8_capture chip8_capture_t;
+
+typedef struct {
+	/* frames received from the machine */
+	unsigned long frames;
+	/* distinct frames queued for the writer */
+	unsigned long distinct;
+	/* frames which didn't fit into the queue */
+	unsigned long dropped;
+} chip8_capture_stats_t;
+
+/*
+ * starts a capture. path is the output file, for CHIP8_CAPTURE_PNG it's a prefix
+ * of the image files and the list is written to <path>.txt. returns NULL on failure.
+ */
+chip8_capture_t* chip8_capture_open(const char* path, int format, size_t queue_length);
+
+/* queues the machine's screen - use as chip8_frame_callback_t with the capture as userdata */
+void chip8_capture_frame(chip8_t* chip, void* capture);
+
+/* writes the remaining frames, stops the writer and frees the capture. stats may be NULL */
+void chip8_capture_close(chip8_capture_t* capture, chip8_capture_stats_t* stats);
+
+#endif
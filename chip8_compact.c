@@ -0,0 +1,243 @@
+#include "chip8_compact.h"
+#include "chip8_cpu.h"
+#include <stdlib.h>
+#include <string.h>
+
+/* bytes of pages and page lists allocated by all machines */
+static volatile unsigned long held = 0;
+
+/* the last page is only as long as the guard */
+static size_t page_length(unsigned short number){
+	size_t offset = (size_t)number * CHIP8_PAGE_SIZE;
+	return sizeof(((chip8_t*)NULL)->memory) - offset < CHIP8_PAGE_SIZE ?
+		sizeof(((chip8_t*)NULL)->memory) - offset : CHIP8_PAGE_SIZE;
+}
+
+static void touch(chip8_scratch_t* scratch, unsigned short number, unsigned char flag){
+	if(scratch->page_state[number] == 0)
+		scratch->touched[scratch->touched_count++] = number;
+	scratch->page_state[number] |= flag;
+}
+
+/* Fx33, Fx55 */
+static void store_handler(chip8_t* chip, opcode_params_t* params){
+	chip8_scratch_t* scratch = (chip8_scratch_t*)chip;
+	/* they write at most 16 bytes, so at most two pages */
+	touch(scratch, chip->I / CHIP8_PAGE_SIZE, CHIP8_SCRATCH_DIRTY);
+	touch(scratch, (chip->I + CHIP_ADDRESS_GUARD - 1) / CHIP8_PAGE_SIZE, CHIP8_SCRATCH_DIRTY);
+	chip8_call_wrapped(store_handler, chip, params);
+}
+
+int chip8_compact_track_writes(void){
+	return chip8_wrap_handlers(0xF0FF, 0xF033, store_handler) && chip8_wrap_handlers(0xF0FF, 0xF055, store_handler);
+}
+
+chip8_image_t* chip8_image_create(const chip8_t* chip){
+	chip8_image_t* image = malloc(sizeof(chip8_image_t));
+	if(image != NULL)
+		memcpy(image->memory, chip->memory, sizeof(image->memory));
+	return image;
+}
+
+void chip8_image_free(chip8_image_t* image){
+	free(image);
+}
+
+void chip8_scratch_init(chip8_scratch_t* scratch, const chip8_t* chip, const chip8_image_t* image){
+	scratch->chip = *chip;
+	scratch->image = image;
+	memset(scratch->page_state, 0, sizeof(scratch->page_state));
+	scratch->touched_count = 0;
+}
+
+static void release(chip8_page_t* page){
+	if(__sync_sub_and_fetch(&page->refs, 1) == 0){
+		free(page);
+		__sync_fetch_and_sub(&held, sizeof(chip8_page_t));
+	}
+}
+
+void chip8_compact_load(chip8_scratch_t* scratch, const chip8_compact_t* compact){
+	chip8_t* chip = &scratch->chip;
+	unsigned char* pixels;
+	unsigned char bits;
+	size_t i;
+	unsigned short number;
+
+	if(scratch->image != compact->image){
+		memcpy(chip->memory, compact->image->memory, sizeof(chip->memory));
+		scratch->image = compact->image;
+	} else {
+		/* only pages of the previous machine differ from the image */
+		for(i = 0; i < scratch->touched_count; ++i){
+			number = scratch->touched[i];
+			memcpy(chip->memory + number * CHIP8_PAGE_SIZE, compact->image->memory + number * CHIP8_PAGE_SIZE,
+				page_length(number));
+		}
+	}
+	for(i = 0; i < scratch->touched_count; ++i)
+		scratch->page_state[scratch->touched[i]] = 0;
+	scratch->touched_count = 0;
+	for(i = 0; i < compact->page_count; ++i){
+		number = compact->pages[i]->number;
+		memcpy(chip->memory + number * CHIP8_PAGE_SIZE, compact->pages[i]->data, page_length(number));
+		touch(scratch, number, CHIP8_SCRATCH_LOADED);
+	}
+
+	memcpy(chip->V, compact->V, sizeof(chip->V));
+	memcpy(chip->stack, compact->stack, sizeof(chip->stack));
+	chip->I = compact->I;
+	chip->pc = compact->pc;
+	chip->sp = compact->sp;
+	chip->opcode = compact->opcode;
+	chip->delay_timer = compact->delay_timer;
+	chip->sound_timer = compact->sound_timer;
+	chip->waiting_keypress = compact->waiting_keypress;
+	chip->last_pressed = compact->last_pressed;
+	chip->random = compact->random;
+	for(i = 0; i < CHIP_KEYS_COUNT; ++i)
+		chip->keys[i] = (compact->keys >> i) & 1;
+	for(i = 0; i < sizeof(compact->gfx); ++i){
+		bits = compact->gfx[i];
+		pixels = chip->gfx + i * 8;
+		pixels[0] = bits >> 7;
+		pixels[1] = (bits >> 6) & 1;
+		pixels[2] = (bits >> 5) & 1;
+		pixels[3] = (bits >> 4) & 1;
+		pixels[4] = (bits >> 3) & 1;
+		pixels[5] = (bits >> 2) & 1;
+		pixels[6] = (bits >> 1) & 1;
+		pixels[7] = bits & 1;
+	}
+}
+
+/* index of the page in compact->pages, or where it belongs */
+static size_t find_page(const chip8_compact_t* compact, unsigned short number){
+	size_t i;
+	for(i = 0; i < compact->page_count && compact->pages[i]->number < number; ++i);
+	return i;
+}
+
+/* keeps the scratch's version of a written page in the machine */
+static int store_page(chip8_scratch_t* scratch, chip8_compact_t* compact, unsigned short number){
+	const unsigned char* data = scratch->chip.memory + number * CHIP8_PAGE_SIZE;
+	size_t length = page_length(number), at = find_page(compact, number);
+	int present = at < compact->page_count && compact->pages[at]->number == number;
+	chip8_page_t** pages;
+	chip8_page_t* page;
+
+	if(memcmp(data, compact->image->memory + number * CHIP8_PAGE_SIZE, length) == 0){
+		/* written back to what the image has */
+		if(present){
+			release(compact->pages[at]);
+			memmove(compact->pages + at, compact->pages + at + 1, (compact->page_count - at - 1) * sizeof(chip8_page_t*));
+			--compact->page_count;
+			__sync_fetch_and_sub(&held, sizeof(chip8_page_t*));
+		}
+		return 1;
+	}
+	if(present && memcmp(data, compact->pages[at]->data, length) == 0)
+		return 1;
+	if(present && compact->pages[at]->refs == 1){
+		/* nobody else sees this page */
+		memcpy(compact->pages[at]->data, data, length);
+		return 1;
+	}
+
+	page = malloc(sizeof(chip8_page_t));
+	if(page == NULL)
+		return 0;
+	__sync_fetch_and_add(&held, sizeof(chip8_page_t));
+	page->refs = 1;
+	page->number = number;
+	memcpy(page->data, data, length);
+	if(present){
+		release(compact->pages[at]);
+		compact->pages[at] = page;
+		return 1;
+	}
+	pages = realloc(compact->pages, (compact->page_count + 1) * sizeof(chip8_page_t*));
+	if(pages == NULL){
+		release(page);
+		return 0;
+	}
+	memmove(pages + at + 1, pages + at, (compact->page_count - at) * sizeof(chip8_page_t*));
+	pages[at] = page;
+	compact->pages = pages;
+	++compact->page_count;
+	__sync_fetch_and_add(&held, sizeof(chip8_page_t*));
+	return 1;
+}
+
+int chip8_compact_store(chip8_scratch_t* scratch, chip8_compact_t* compact){
+	chip8_t* chip = &scratch->chip;
+	unsigned char* pixels;
+	size_t i;
+	unsigned short number;
+
+	compact->image = scratch->image;
+	for(i = 0; i < scratch->touched_count; ++i){
+		number = scratch->touched[i];
+		if(!(scratch->page_state[number] & CHIP8_SCRATCH_DIRTY))
+			continue;
+		if(!store_page(scratch, compact, number))
+			return 0;
+		/* the machine has this version now */
+		scratch->page_state[number] = CHIP8_SCRATCH_LOADED;
+	}
+
+	memcpy(compact->V, chip->V, sizeof(compact->V));
+	memcpy(compact->stack, chip->stack, sizeof(compact->stack));
+	compact->I = chip->I;
+	compact->pc = chip->pc;
+	compact->sp = chip->sp;
+	compact->opcode = chip->opcode;
+	compact->delay_timer = chip->delay_timer;
+	compact->sound_timer = chip->sound_timer;
+	compact->waiting_keypress = chip->waiting_keypress;
+	compact->last_pressed = chip->last_pressed;
+	compact->random = chip->random;
+	compact->keys = 0;
+	for(i = 0; i < CHIP_KEYS_COUNT; ++i)
+		compact->keys |= (chip->keys[i] != 0) << i;
+	for(i = 0; i < sizeof(compact->gfx); ++i){
+		pixels = chip->gfx + i * 8;
+		compact->gfx[i] = (pixels[0] != 0) << 7 | (pixels[1] != 0) << 6 | (pixels[2] != 0) << 5 | (pixels[3] != 0) << 4
+			| (pixels[4] != 0) << 3 | (pixels[5] != 0) << 2 | (pixels[6] != 0) << 1 | (pixels[7] != 0);
+	}
+	return 1;
+}
+
+int chip8_compact_copy(chip8_compact_t* to, const chip8_compact_t* from){
+	size_t i;
+	*to = *from;
+	if(from->page_count == 0){
+		to->pages = NULL;
+		return 1;
+	}
+	to->pages = malloc(from->page_count * sizeof(chip8_page_t*));
+	if(to->pages == NULL){
+		to->page_count = 0;
+		return 0;
+	}
+	for(i = 0; i < from->page_count; ++i){
+		to->pages[i] = from->pages[i];
+		__sync_fetch_and_add(&to->pages[i]->refs, 1);
+	}
+	__sync_fetch_and_add(&held, from->page_count * sizeof(chip8_page_t*));
+	return 1;
+}
+
+unsigned long chip8_compact_bytes(void){
+	return held;
+}
+
+void chip8_compact_free(chip8_compact_t* compact){
+	size_t i;
+	for(i = 0; i < compact->page_count; ++i)
+		release(compact->pages[i]);
+	__sync_fetch_and_sub(&held, compact->page_count * sizeof(chip8_page_t*));
+	free(compact->pages);
+	compact->pages = NULL;
+	compact->page_count = 0;
+}
@@ -0,0 +1,99 @@
+#ifndef __CHIP8_COMPACT_H__
+#define __CHIP8_COMPACT_H__
+
+#include "chip8.h"
+
+/*
+ * Compact machines - for keeping very many machines which run the same program.
+ *
+ * A chip8_t holds the whole address space. A chip8_compact_t only holds the
+ * registers, a 1 bit per pixel screen and a pointer to a read-only image of
+ * the memory (fonts + program) which is shared by all machines made from it.
+ * Pages of memory written by Fx33/Fx55 are kept separately by the machine.
+ * Copies of a machine share these pages as well, a page is copied only
+ * when one of the machines stores a different version of it.
+ *
+ * Compact machines don't run by themselves: chip8_compact_load unpacks one
+ * into a chip8_scratch_t, whose chip runs as usual, and chip8_compact_store
+ * packs it back. Writes are noticed by wrapping the Fx33/Fx55 handlers
+ * (chip8_compact_track_writes), so after that every machine in the process
+ * has to run inside a chip8_scratch_t.
+ */
+
+#define CHIP8_PAGE_SIZE		256
+#define CHIP8_PAGE_COUNT	((CHIP_ADDRESS_SPACE + CHIP_ADDRESS_GUARD + CHIP8_PAGE_SIZE - 1) / CHIP8_PAGE_SIZE)
+
+/* memory of a machine when it was created */
+typedef struct {
+	unsigned char memory[CHIP_ADDRESS_SPACE + CHIP_ADDRESS_GUARD];
+} chip8_image_t;
+
+/* a page which differs from the image, shared by all machines which refer to it */
+typedef struct {
+	volatile unsigned long refs;
+	unsigned short number;
+	unsigned char data[CHIP8_PAGE_SIZE];
+} chip8_page_t;
+
+typedef struct {
+	const chip8_image_t* image;
+	/* pages which differ from the image, sorted by number */
+	chip8_page_t** pages;
+	unsigned short page_count;
+	unsigned short I, pc, sp, opcode;
+	/* 1 bit per key */
+	unsigned short keys;
+	unsigned short stack[CHIP_STACK_DEPTH];
+	unsigned char V[CHIP_REGISTER_COUNT];
+	unsigned char delay_timer, sound_timer, waiting_keypress, last_pressed;
+	unsigned long random;
+	/* 1 bit per pixel, most significant bit is the leftmost pixel */
+	unsigned char gfx[CHIP_GFX_WIDTH * CHIP_GFX_HEIGHT / 8];
+} chip8_compact_t;
+
+/* full machine which compact machines are unpacked into. chip has to be the first member */
+typedef struct {
+	chip8_t chip;
+	/* image in chip.memory */
+	const chip8_image_t* image;
+	/* CHIP8_SCRATCH_* flags of every page and the pages which have some */
+	unsigned char page_state[CHIP8_PAGE_COUNT];
+	unsigned short touched[CHIP8_PAGE_COUNT];
+	size_t touched_count;
+} chip8_scratch_t;
+
+/* the page holds a page of the loaded machine / was written since */
+#define CHIP8_SCRATCH_LOADED	1
+#define CHIP8_SCRATCH_DIRTY	2
+
+/* copies the memory of a machine, returns NULL on failure */
+chip8_image_t* chip8_image_create(const chip8_t* chip);
+
+/* frees the image, there can't be any machines which use it */
+void chip8_image_free(chip8_image_t* image);
+
+/* wraps Fx33/Fx55 handlers so that they mark pages they write, returns 0 on failure */
+int chip8_compact_track_writes(void);
+
+/* starts running chip, its memory has to be the same as the image */
+void chip8_scratch_init(chip8_scratch_t* scratch, const chip8_t* chip, const chip8_image_t* image);
+
+/* unpacks a machine into the scratch */
+void chip8_compact_load(chip8_scratch_t* scratch, const chip8_compact_t* compact);
+
+/*
+ * packs the machine in the scratch. compact has to be the machine which was loaded,
+ * a copy of it, or zeroed if the scratch was started by chip8_scratch_init. returns 0 on failure
+ */
+int chip8_compact_store(chip8_scratch_t* scratch, chip8_compact_t* compact);
+
+/* makes a copy which shares pages with the original, returns 0 on failure */
+int chip8_compact_copy(chip8_compact_t* to, const chip8_compact_t* from);
+
+/* bytes of pages and page lists all machines hold, each shared page counts once */
+unsigned long chip8_compact_bytes(void);
+
+/* releases pages of the machine */
+void chip8_compact_free(chip8_compact_t* compact);
+
+#endif
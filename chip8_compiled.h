@@ -0,0 +1,43 @@
+#ifndef __CHIP8_COMPILED_H__
+#define __CHIP8_COMPILED_H__
+
+#include "chip8.h"
+
+/*
+ * Interface of a translation unit emitted by chip8_recompile.
+ *
+ * The generated unit contains the ROM translated to C. It only covers code
+ * which could be found statically, so it has to be driven together with the
+ * interpreter:
+ *
+ *	chip8_select_quirks(chip8_compiled_quirks);
+ *	stale = !chip8_compiled_valid(&chip);
+ *	while(running){
+ *		if(stale || chip8_compiled_run(&chip, budget, &stale) == 0)
+ *			chip8_cycle(&chip);
+ *	}
+ *
+ * The unit has to be entered after every instruction the interpreter runs, as
+ * above: that's where it notices Fx33/Fx55 run by the interpreter which
+ * overwrote translated code.
+ */
+
+/* quirk profile the unit was translated for, pass it to chip8_select_quirks */
+extern const int chip8_compiled_quirks;
+
+/* memory image (fonts + ROM) the unit was translated from */
+extern const unsigned char chip8_compiled_image[CHIP_MEMORY_SIZE];
+
+/* 1 if the machine's memory holds the code the unit was translated from, otherwise 0.
+ * this compares all translated code, so call it once after loading the program */
+int chip8_compiled_valid(chip8_t* chip);
+
+/*
+ * runs translated code starting at chip->pc until budget cycles were executed
+ * or pc leaves the translated code. returns number of cycles executed - 0 means the
+ * interpreter has to execute the next instruction. *stale is set to 1 once the program
+ * overwrites its own code - translated code must not be used for this machine anymore.
+ */
+long chip8_compiled_run(chip8_t* chip, long budget, int* stale);
+
+#endif
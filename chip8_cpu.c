@@ -1,8 +1,11 @@
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 
 #include "chip8_cpu.h"
 #include "chip8.h"
 #include "chip8_impl.h"
+#include "chip8_quirks.h"
 
 /* "unknown instruction callback" - prints error message */
 static void chip8_uic(chip8_t* chip, opcode_params_t* params){
@@ -14,9 +17,195 @@ static void chip8_uic(chip8_t* chip, opcode_params_t* params){
 static void (*opcode_table[65536]) (chip8_t*,opcode_params_t*) = {chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_clear_screen,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_subroutine_return,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_jump,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_callsub,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifnvx,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifxy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_setvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_addvx,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_setvxvy,chip8_orvxvy,chip8_andvxvy,chip8_xorvxvy,chip8_addvxvy,chip8_subvxvy,chip8_shrvx,chip8_subnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_shlvx,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipifnvxvy,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_seti,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_jumpr,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_rand,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_draw,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipkeydown,chip8_uic,chip8_uic,chip8_skipkeyup,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipkeydown,chip8_uic,chip8_uic,chip8_skipkeyup,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipkeydown,chip8_uic,chip8_uic,chip8_skipkeyup,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipkeydown,chip8_uic,chip8_uic,chip8_skipkeyup,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipkeydown,chip8_uic,chip8_uic,chip8_skipkeyup,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipkeydown,chip8_uic,chip8_uic,chip8_skipkeyup,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipkeydown,chip8_uic,chip8_uic,chip8_skipkeyup,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipkeydown,chip8_uic,chip8_uic,chip8_skipkeyup,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipkeydown,chip8_uic,chip8_uic,chip8_skipkeyup,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipkeydown,chip8_uic,chip8_uic,chip8_skipkeyup,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipkeydown,chip8_uic,chip8_uic,chip8_skipkeyup,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipkeydown,chip8_uic,chip8_uic,chip8_skipkeyup,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipkeydown,chip8_uic,chip8_uic,chip8_skipkeyup,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipkeydown,chip8_uic,chip8_uic,chip8_skipkeyup,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipkeydown,chip8_uic,chip8_uic,chip8_skipkeyup,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_skipkeydown,chip8_uic,chip8_uic,chip8_skipkeyup,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_setvxdt,chip8_uic,chip8_uic,chip8_waitkeypress,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_setdtvx,chip8_uic,chip8_uic,chip8_setstvx,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_addivx,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_digisprite,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_bcdvx,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_writereg,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_loadreg,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_setvxdt,chip8_uic,chip8_uic,chip8_waitkeypress,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_setdtvx,chip8_uic,chip8_uic,chip8_setstvx,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_addivx,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_digisprite,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_bcdvx,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_writereg,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_loadreg,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_setvxdt,chip8_uic,chip8_uic,chip8_waitkeypress,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_setdtvx,chip8_uic,chip8_uic,chip8_setstvx,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_addivx,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_digisprite,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_bcdvx,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_writereg,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_loadreg,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_setvxdt,chip8_uic,chip8_uic,chip8_waitkeypress,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_setdtvx,chip8_uic,chip8_uic,chip8_setstvx,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_addivx,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_digisprite,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_bcdvx,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_writereg,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_loadreg,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_setvxdt,chip8_uic,chip8_uic,chip8_waitkeypress,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_setdtvx,chip8_uic,chip8_uic,chip8_setstvx,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_addivx,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_digisprite,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_bcdvx,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_writereg,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_loadreg,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_setvxdt,chip8_uic,chip8_uic,chip8_waitkeypress,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_setdtvx,chip8_uic,chip8_uic,chip8_setstvx,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_addivx,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_digisprite,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_bcdvx,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_writereg,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_loadreg,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_setvxdt,chip8_uic,chip8_uic,chip8_waitkeypress,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_setdtvx,chip8_uic,chip8_uic,chip8_setstvx,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_addivx,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_digisprite,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_bcdvx,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_writereg,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_loadreg,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_setvxdt,chip8_uic,chip8_uic,chip8_waitkeypress,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_setdtvx,chip8_uic,chip8_uic,chip8_setstvx,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_addivx,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_digisprite,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_bcdvx,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_writereg,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_loadreg,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_setvxdt,chip8_uic,chip8_uic,chip8_waitkeypress,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_setdtvx,chip8_uic,chip8_uic,chip8_setstvx,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_addivx,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_digisprite,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_bcdvx,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_writereg,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_loadreg,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_setvxdt,chip8_uic,chip8_uic,chip8_waitkeypress,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_setdtvx,chip8_uic,chip8_uic,chip8_setstvx,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_addivx,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_digisprite,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_bcdvx,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_writereg,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_loadreg,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_setvxdt,chip8_uic,chip8_uic,chip8_waitkeypress,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_setdtvx,chip8_uic,chip8_uic,chip8_setstvx,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_addivx,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_digisprite,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_bcdvx,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_writereg,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_loadreg,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_setvxdt,chip8_uic,chip8_uic,chip8_waitkeypress,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_setdtvx,chip8_uic,chip8_uic,chip8_setstvx,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_addivx,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_digisprite,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_bcdvx,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_writereg,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_loadreg,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_setvxdt,chip8_uic,chip8_uic,chip8_waitkeypress,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_setdtvx,chip8_uic,chip8_uic,chip8_setstvx,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_addivx,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_digisprite,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_bcdvx,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_writereg,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_loadreg,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_setvxdt,chip8_uic,chip8_uic,chip8_waitkeypress,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_setdtvx,chip8_uic,chip8_uic,chip8_setstvx,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_addivx,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_digisprite,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_bcdvx,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_writereg,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_loadreg,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_setvxdt,chip8_uic,chip8_uic,chip8_waitkeypress,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_setdtvx,chip8_uic,chip8_uic,chip8_setstvx,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_addivx,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_digisprite,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_bcdvx,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_writereg,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_loadreg,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_setvxdt,chip8_uic,chip8_uic,chip8_waitkeypress,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_setdtvx,chip8_uic,chip8_uic,chip8_setstvx,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_addivx,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_digisprite,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_bcdvx,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_writereg,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_loadreg,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic,chip8_uic};
 
 
+/* table of the selected quirk profile, the table above is CHIP8_QUIRKS_DEFAULT */
+static chip8_handler_t* base_table = opcode_table;
+/* table which runs - base_table, or wrapped_table while there are wrappers */
+static chip8_handler_t* active_table = opcode_table;
+/* base_table with wrappers on top of its handlers, allocated by the first wrapper */
+static chip8_handler_t* wrapped_table = NULL;
+/* CHIP8_QUIRKS_* of base_table */
+static int selected_profile = CHIP8_QUIRKS_DEFAULT;
+/* tables of other profiles, built on first use */
+static chip8_handler_t* profile_tables[CHIP8_QUIRKS_COUNT];
+
+typedef struct {
+	unsigned short mask, pattern;
+	/* 1 - wraps opcodes which aren't instructions instead of mask/pattern */
+	int unknown;
+	chip8_handler_t wrapper;
+} wrap_t;
+
+/* installed wrappers, the first one is the closest to the instructions */
+static wrap_t wraps[CHIP8_MAX_WRAPPERS];
+static size_t wrap_count = 0;
+
 void chip8_execute_opcode(chip8_t* chip, opcode_params_t* params){
-	printf("%4hx (%3hx, %2hx, %1hx, %1hx, %1hx)\n", chip->opcode, params->nnn, params->nn, params->n, params->x, params->y);
 	/* using the opcode table above, we can translate CPU instructions really quickly */
-	opcode_table[chip->opcode](chip, params);
+	active_table[chip->opcode](chip, params);
+}
+
+chip8_handler_t chip8_get_handler(unsigned short opcode){
+	return active_table[opcode];
+}
+
+int chip8_valid_opcode(unsigned short opcode){
+	return opcode_table[opcode] != chip8_uic;
+}
+
+static int wraps_opcode(const wrap_t* wrap, unsigned short opcode){
+	if(wrap->unknown)
+		return !chip8_valid_opcode(opcode);
+	return (opcode & wrap->mask) == wrap->pattern;
+}
+
+/* what runs the opcode if only the first count wrappers were installed */
+static chip8_handler_t handler_below(unsigned short opcode, size_t count){
+	while(count > 0){
+		--count;
+		if(wraps_opcode(&wraps[count], opcode))
+			return wraps[count].wrapper;
+	}
+	return base_table[opcode];
+}
+
+void chip8_set_handler(unsigned short opcode, chip8_handler_t handler){
+	base_table[opcode] = handler;
+	if(active_table != base_table)
+		active_table[opcode] = handler_below(opcode, wrap_count);
+}
+
+static int wrap(unsigned short mask, unsigned short pattern, int unknown, chip8_handler_t wrapper){
+	wrap_t* added;
+	unsigned long opcode;
+
+	if(wrap_count == CHIP8_MAX_WRAPPERS)
+		return 0;
+	if(wrap_count == 0){
+		if(wrapped_table == NULL)
+			wrapped_table = malloc(sizeof(opcode_table));
+		if(wrapped_table == NULL)
+			return 0;
+		memcpy(wrapped_table, base_table, sizeof(opcode_table));
+		active_table = wrapped_table;
+	}
+	added = &wraps[wrap_count++];
+	added->mask = mask;
+	added->pattern = pattern;
+	added->unknown = unknown;
+	added->wrapper = wrapper;
+	for(opcode = 0; opcode < 65536; ++opcode){
+		if(wraps_opcode(added, opcode))
+			active_table[opcode] = wrapper;
+	}
+	return 1;
+}
+
+int chip8_wrap_handlers(unsigned short mask, unsigned short pattern, chip8_handler_t wrapper){
+	return wrap(mask, pattern, 0, wrapper);
+}
+
+int chip8_wrap_unknown(chip8_handler_t wrapper){
+	return wrap(0, 0, 1, wrapper);
+}
+
+void chip8_unwrap_handlers(unsigned short mask, unsigned short pattern, chip8_handler_t wrapper){
+	wrap_t removed;
+	unsigned long opcode;
+	size_t i;
+
+	for(i = wrap_count; i > 0; --i){
+		removed = wraps[i - 1];
+		if(!removed.unknown && removed.mask == mask && removed.pattern == pattern && removed.wrapper == wrapper)
+			break;
+	}
+	if(i == 0)
+		return;
+	memmove(wraps + i - 1, wraps + i, (wrap_count - i) * sizeof(wrap_t));
+	--wrap_count;
+	if(wrap_count == 0){
+		active_table = base_table;
+		return;
+	}
+	for(opcode = 0; opcode < 65536; ++opcode){
+		if(wraps_opcode(&removed, opcode))
+			active_table[opcode] = handler_below(opcode, wrap_count);
+	}
+}
+
+void chip8_call_wrapped(chip8_handler_t wrapper, chip8_t* chip, opcode_params_t* params){
+	size_t i;
+	/* the wrapper which is running is the topmost one of its kind for the opcode */
+	for(i = wrap_count; i > 0; --i){
+		if(wraps[i - 1].wrapper == wrapper && wraps_opcode(&wraps[i - 1], chip->opcode))
+			break;
+	}
+	if(i == 0){
+		/* the wrapper removed itself while it was running */
+		active_table[chip->opcode](chip, params);
+		return;
+	}
+	handler_below(chip->opcode, i - 1)(chip, params);
+}
+
+/* installs handler for every opcode which matches the pattern in bits of the mask */
+static void override(chip8_handler_t* table, unsigned short mask, unsigned short pattern, chip8_handler_t handler){
+	unsigned long opcode;
+	for(opcode = 0; opcode < 65536; ++opcode){
+		if((opcode & mask) == pattern)
+			table[opcode] = handler;
+	}
+}
+
+/* copies the default table and replaces handlers which behave differently in the profile */
+static chip8_handler_t* build_table(int profile){
+	chip8_handler_t* table = malloc(sizeof(opcode_table));
+	if(table == NULL)
+		return NULL;
+	memcpy(table, opcode_table, sizeof(opcode_table));
+	switch(profile){
+	case CHIP8_QUIRKS_VIP:
+		override(table, 0xF00F, 0x8001, chip8_orvxvy_vfreset);
+		override(table, 0xF00F, 0x8002, chip8_andvxvy_vfreset);
+		override(table, 0xF00F, 0x8003, chip8_xorvxvy_vfreset);
+		override(table, 0xF00F, 0x8006, chip8_shrvy);
+		override(table, 0xF00F, 0x800E, chip8_shlvy);
+		override(table, 0xF000, 0xB000, chip8_jumpr_v0);
+		override(table, 0xF000, 0xD000, chip8_draw_clip);
+		override(table, 0xF0FF, 0xF055, chip8_writereg_inci);
+		override(table, 0xF0FF, 0xF065, chip8_loadreg_inci);
+		break;
+	case CHIP8_QUIRKS_SCHIP:
+		override(table, 0xF000, 0xD000, chip8_draw_clip);
+		override(table, 0xF0FF, 0xF055, chip8_writereg_keepi);
+		override(table, 0xF0FF, 0xF065, chip8_loadreg_keepi);
+		break;
+	case CHIP8_QUIRKS_MODERN:
+		override(table, 0xF000, 0xB000, chip8_jumpr_v0);
+		override(table, 0xF0FF, 0xF055, chip8_writereg_keepi);
+		override(table, 0xF0FF, 0xF065, chip8_loadreg_keepi);
+		break;
+	}
+	return table;
+}
+
+int chip8_select_quirks(int profile){
+	if(profile < 0 || profile >= CHIP8_QUIRKS_COUNT || wrap_count > 0)
+		return 0;
+	if(profile == CHIP8_QUIRKS_DEFAULT){
+		base_table = active_table = opcode_table;
+		selected_profile = profile;
+		return 1;
+	}
+	if(profile_tables[profile] == NULL)
+		profile_tables[profile] = build_table(profile);
+	if(profile_tables[profile] == NULL)
+		return 0;
+	base_table = active_table = profile_tables[profile];
+	selected_profile = profile;
+	return 1;
+}
+
+int chip8_selected_quirks(void){
+	return selected_profile;
 }
 
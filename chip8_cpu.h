@@ -3,7 +3,50 @@
 
 #include "chip8.h"
 
+/* function which executes an opcode (see chip8_impl.h) */
+typedef void (*chip8_handler_t)(chip8_t* chip, opcode_params_t* params);
+
 /* executes a single opcode */
 void chip8_execute_opcode(chip8_t* chip, opcode_params_t* params);
 
+/* returns handler which is currently installed for the opcode */
+chip8_handler_t chip8_get_handler(unsigned short opcode);
+
+/* installs a different handler for the opcode, wrappers stay on top of it */
+void chip8_set_handler(unsigned short opcode, chip8_handler_t handler);
+
+/* returns 0 if the opcode is not an instruction */
+int chip8_valid_opcode(unsigned short opcode);
+
+/*
+ * Wrappers - handlers which run instead of the handlers of some opcodes, to watch
+ * or change what they do (chip8_debug.c, chip8_compact.c, chip8_explore.c, chip8_fuzz.c).
+ * A wrapper runs the instruction by chip8_call_wrapped, which calls the next wrapper
+ * of the opcode or its handler, so wrappers don't depend on the order they were
+ * installed in and don't need to remember the handlers they replaced.
+ */
+
+/* wrappers which can be installed at the same time */
+#define CHIP8_MAX_WRAPPERS	16
+
+/* wraps every opcode for which (opcode & mask) == pattern, returns 0 on failure */
+int chip8_wrap_handlers(unsigned short mask, unsigned short pattern, chip8_handler_t wrapper);
+
+/* wraps every opcode which is not an instruction, returns 0 on failure */
+int chip8_wrap_unknown(chip8_handler_t wrapper);
+
+/* removes a wrapper installed by chip8_wrap_handlers with the same arguments */
+void chip8_unwrap_handlers(unsigned short mask, unsigned short pattern, chip8_handler_t wrapper);
+
+/* runs whatever wrapper wrapped for chip->opcode */
+void chip8_call_wrapped(chip8_handler_t wrapper, chip8_t* chip, opcode_params_t* params);
+
+/* switches to the opcode table of a quirk profile (CHIP8_QUIRKS_*, see chip8_quirks.h), returns 0 on failure.
+ * call it before the machine starts and before anything is wrapped - handlers installed by
+ * chip8_set_handler stay in the previous table */
+int chip8_select_quirks(int profile);
+
+/* returns the quirk profile which was selected last, CHIP8_QUIRKS_DEFAULT if none was */
+int chip8_selected_quirks(void);
+
 #endif
@@ -0,0 +1,327 @@
+#include "chip8_debug.h"
+#include "chip8_cpu.h"
+#include "chip8_quirks.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef struct {
+	unsigned short addr;
+	unsigned char reg;
+	unsigned char cond;
+	unsigned char value;
+} breakpoint_t;
+
+typedef struct {
+	unsigned short lo, hi;
+	unsigned char kind;
+} watchpoint_t;
+
+static breakpoint_t breakpoints[CHIP8_DEBUG_MAX_BREAKPOINTS];
+static size_t breakpoint_count = 0;
+static watchpoint_t watchpoints[CHIP8_DEBUG_MAX_WATCHPOINTS];
+static size_t watchpoint_count = 0;
+/* 1 if the machine should stop before the next instruction */
+static int stepping = 0;
+
+/* which opcodes are wrapped by debug_handler */
+#define WRAP_NONE	0
+/* instructions which access memory, for watchpoints */
+#define WRAP_MEMORY	1
+/* all of them, for breakpoints and stepping */
+#define WRAP_ALL	2
+static int wrapping = WRAP_NONE;
+
+/* mask, pattern of the instructions memory_access knows */
+static const unsigned short memory_opcodes[][2] = {
+	{ 0xF000, 0xD000 }, { 0xF0FF, 0xF033 }, { 0xF0FF, 0xF055 }, { 0xF0FF, 0xF065 }
+};
+
+/* reads from / writes to memory at I, returns CHIP8_WATCH_* flags */
+static unsigned char memory_access(unsigned short opcode){
+	if((opcode & 0xF000) == 0xD000)
+		return CHIP8_WATCH_READ;
+	if((opcode & 0xF000) != 0xF000)
+		return 0;
+	switch(opcode & 0x00FF){
+	case 0x33:
+	case 0x55:
+		return CHIP8_WATCH_WRITE;
+	case 0x65:
+		return CHIP8_WATCH_READ;
+	}
+	return 0;
+}
+
+/* addresses touched by a memory opcode, returns 0 if it doesn't touch any */
+static int access_range(chip8_t* chip, opcode_params_t* params, unsigned short* lo, unsigned short* hi){
+	unsigned short length;
+	if((chip->opcode & 0xF000) == 0xD000)
+		length = params->n > 0 ? params->n : 1;
+	else if((chip->opcode & 0x00FF) == 0x33)
+		length = 3;
+	else if(chip8_selected_quirks() == CHIP8_QUIRKS_DEFAULT)
+		/* Fx55/Fx65 only transfer V0 through V(x-1) there, see chip8_quirks.h */
+		length = params->x;
+	else
+		length = params->x + 1;
+	if(length == 0)
+		return 0;
+	*lo = chip->I;
+	*hi = chip->I + length - 1;
+	return 1;
+}
+
+static int condition_holds(chip8_t* chip, breakpoint_t* bp){
+	unsigned char v = chip->V[bp->reg];
+	switch(bp->cond){
+	case CHIP8_COND_EQ:
+		return v == bp->value;
+	case CHIP8_COND_NE:
+		return v != bp->value;
+	case CHIP8_COND_LT:
+		return v < bp->value;
+	case CHIP8_COND_GT:
+		return v > bp->value;
+	}
+	return 1;
+}
+
+static void update_handlers(void);
+
+static void debug_handler(chip8_t* chip, opcode_params_t* params){
+	/* chip8_cycle has already moved pc to the next instruction */
+	unsigned short pc = chip->pc - 2, lo, hi;
+	size_t i;
+
+	if(stepping){
+		stepping = 0;
+		chip8_debug_prompt(chip);
+		/* unwrap handlers unless the user keeps stepping */
+		if(!stepping)
+			update_handlers();
+	} else {
+		for(i = 0; i < breakpoint_count; ++i){
+			if(breakpoints[i].addr == pc && condition_holds(chip, &breakpoints[i])){
+				printf("breakpoint at %03hx\n", pc);
+				chip8_debug_prompt(chip);
+				break;
+			}
+		}
+	}
+	if(watchpoint_count > 0 && memory_access(chip->opcode) && access_range(chip, params, &lo, &hi)){
+		for(i = 0; i < watchpoint_count; ++i){
+			if((watchpoints[i].kind & memory_access(chip->opcode))
+					&& lo <= watchpoints[i].hi && hi >= watchpoints[i].lo){
+				printf("watchpoint %03hx-%03hx: %04hx at %03hx touches %03hx-%03hx\n",
+					watchpoints[i].lo, watchpoints[i].hi, chip->opcode, pc, lo, hi);
+				chip8_debug_prompt(chip);
+				break;
+			}
+		}
+	}
+	chip8_call_wrapped(debug_handler, chip, params);
+}
+
+/* wraps handlers which have to be checked, restores the rest */
+static void update_handlers(void){
+	int want = breakpoint_count > 0 || stepping ? WRAP_ALL : watchpoint_count > 0 ? WRAP_MEMORY : WRAP_NONE;
+	int ok = 1;
+	size_t i, count = sizeof(memory_opcodes) / sizeof(memory_opcodes[0]);
+
+	if(want == wrapping)
+		return;
+	if(wrapping == WRAP_ALL)
+		chip8_unwrap_handlers(0, 0, debug_handler);
+	for(i = 0; wrapping == WRAP_MEMORY && i < count; ++i)
+		chip8_unwrap_handlers(memory_opcodes[i][0], memory_opcodes[i][1], debug_handler);
+	if(want == WRAP_ALL)
+		ok = chip8_wrap_handlers(0, 0, debug_handler);
+	for(i = 0; want == WRAP_MEMORY && i < count; ++i)
+		ok = ok && chip8_wrap_handlers(memory_opcodes[i][0], memory_opcodes[i][1], debug_handler);
+	if(!ok)
+		printf("too many handlers are wrapped, the debugger may miss instructions\n");
+	wrapping = want;
+}
+
+int chip8_debug_break(unsigned short addr){
+	return chip8_debug_break_if(addr, 0, CHIP8_COND_NONE, 0);
+}
+
+int chip8_debug_break_if(unsigned short addr, unsigned char reg, unsigned char cond, unsigned char value){
+	if(breakpoint_count == CHIP8_DEBUG_MAX_BREAKPOINTS || reg >= CHIP_REGISTER_COUNT)
+		return 0;
+	breakpoints[breakpoint_count].addr = addr;
+	breakpoints[breakpoint_count].reg = reg;
+	breakpoints[breakpoint_count].cond = cond;
+	breakpoints[breakpoint_count].value = value;
+	++breakpoint_count;
+	update_handlers();
+	return 1;
+}
+
+void chip8_debug_delete(unsigned short addr){
+	size_t i = 0;
+	while(i < breakpoint_count){
+		if(breakpoints[i].addr == addr)
+			breakpoints[i] = breakpoints[--breakpoint_count];
+		else
+			++i;
+	}
+	update_handlers();
+}
+
+int chip8_debug_watch(unsigned short lo, unsigned short hi, unsigned char kind){
+	if(watchpoint_count == CHIP8_DEBUG_MAX_WATCHPOINTS || hi < lo)
+		return 0;
+	watchpoints[watchpoint_count].lo = lo;
+	watchpoints[watchpoint_count].hi = hi;
+	watchpoints[watchpoint_count].kind = kind;
+	++watchpoint_count;
+	update_handlers();
+	return 1;
+}
+
+void chip8_debug_unwatch(unsigned short lo){
+	size_t i = 0;
+	while(i < watchpoint_count){
+		if(watchpoints[i].lo == lo)
+			watchpoints[i] = watchpoints[--watchpoint_count];
+		else
+			++i;
+	}
+	update_handlers();
+}
+
+void chip8_debug_step(void){
+	stepping = 1;
+	update_handlers();
+}
+
+void chip8_debug_cleanup(void){
+	breakpoint_count = 0;
+	watchpoint_count = 0;
+	stepping = 0;
+	update_handlers();
+}
+
+static void print_registers(chip8_t* chip){
+	int i;
+	for(i = 0; i < CHIP_REGISTER_COUNT; ++i)
+		printf("V%X=%02x%s", i, chip->V[i], i % 8 == 7 ? "\n" : " ");
+	printf("I=%03hx PC=%03hx SP=%hu DT=%02x ST=%02x opcode=%04hx\n", chip->I, chip->pc - 2, chip->sp,
+		chip->delay_timer, chip->sound_timer, chip->opcode);
+}
+
+static void print_stack(chip8_t* chip){
+	int i;
+	printf("#0 %03hx\n", chip->pc - 2);
+	/* stack[1..sp] hold return addresses, see chip8_callsub */
+	for(i = chip->sp; i > 0 && i < CHIP_STACK_DEPTH; --i)
+		printf("#%d %03hx (called from %03hx)\n", chip->sp - i + 1, chip->stack[i], chip->stack[i] - 2);
+}
+
+static void print_memory(chip8_t* chip, unsigned long addr, unsigned long length){
+	unsigned long i;
+	for(i = 0; i < length && addr + i < CHIP_ADDRESS_SPACE; ++i){
+		if(i % 16 == 0)
+			printf("%s%03lx:", i > 0 ? "\n" : "", addr + i);
+		printf(" %02x", chip->memory[addr + i]);
+	}
+	printf("\n");
+}
+
+static void print_points(void){
+	static const char* conditions[] = {"", "==", "!=", "<", ">"};
+	size_t i;
+	for(i = 0; i < breakpoint_count; ++i){
+		printf("break %03hx", breakpoints[i].addr);
+		if(breakpoints[i].cond != CHIP8_COND_NONE)
+			printf(" if V%X %s %02x", breakpoints[i].reg, conditions[breakpoints[i].cond], breakpoints[i].value);
+		printf("\n");
+	}
+	for(i = 0; i < watchpoint_count; ++i){
+		printf("watch %03hx-%03hx %s%s\n", watchpoints[i].lo, watchpoints[i].hi,
+			watchpoints[i].kind & CHIP8_WATCH_READ ? "r" : "",
+			watchpoints[i].kind & CHIP8_WATCH_WRITE ? "w" : "");
+	}
+}
+
+static unsigned char parse_condition(const char* op){
+	if(strcmp(op, "==") == 0)
+		return CHIP8_COND_EQ;
+	if(strcmp(op, "!=") == 0)
+		return CHIP8_COND_NE;
+	if(strcmp(op, "<") == 0)
+		return CHIP8_COND_LT;
+	if(strcmp(op, ">") == 0)
+		return CHIP8_COND_GT;
+	return CHIP8_COND_NONE;
+}
+
+static void print_help(void){
+	printf("c                      continue\n"
+		"s                      step one instruction\n"
+		"r                      show registers\n"
+		"bt                     show call stack\n"
+		"m <addr> [len]         show memory\n"
+		"b <addr> [Vx op kk]    break at addr (op is one of == != < >)\n"
+		"d <addr>               delete breakpoints at addr\n"
+		"w <lo> <hi> [r|w|rw]   watch memory accesses\n"
+		"u <lo>                 delete watchpoints starting at lo\n"
+		"l                      list breakpoints and watchpoints\n"
+		"q                      quit\n"
+		"all numbers are hexadecimal\n");
+}
+
+void chip8_debug_prompt(chip8_t* chip){
+	char line[128], command[8], arg1[16], arg2[16], arg3[16], arg4[16];
+	int count;
+
+	printf("%03hx: %04hx\n", chip->pc - 2, chip->opcode);
+	for(;;){
+		printf("(chip8) ");
+		fflush(stdout);
+		if(fgets(line, sizeof(line), stdin) == NULL)
+			return;
+		count = sscanf(line, "%7s %15s %15s %15s %15s", command, arg1, arg2, arg3, arg4);
+		if(count < 1)
+			continue;
+		if(strcmp(command, "c") == 0){
+			return;
+		} else if(strcmp(command, "s") == 0){
+			chip8_debug_step();
+			return;
+		} else if(strcmp(command, "r") == 0){
+			print_registers(chip);
+		} else if(strcmp(command, "bt") == 0){
+			print_stack(chip);
+		} else if(strcmp(command, "m") == 0 && count >= 2){
+			print_memory(chip, strtoul(arg1, NULL, 16), count >= 3 ? strtoul(arg2, NULL, 16) : 16);
+		} else if(strcmp(command, "b") == 0 && count == 2){
+			if(!chip8_debug_break(strtoul(arg1, NULL, 16)))
+				printf("too many breakpoints\n");
+		} else if(strcmp(command, "b") == 0 && count == 5 && (arg2[0] == 'V' || arg2[0] == 'v')
+				&& parse_condition(arg3) != CHIP8_COND_NONE){
+			if(!chip8_debug_break_if(strtoul(arg1, NULL, 16), strtoul(arg2 + 1, NULL, 16),
+					parse_condition(arg3), strtoul(arg4, NULL, 16)))
+				printf("invalid breakpoint\n");
+		} else if(strcmp(command, "d") == 0 && count == 2){
+			chip8_debug_delete(strtoul(arg1, NULL, 16));
+		} else if(strcmp(command, "w") == 0 && count >= 3){
+			unsigned char kind = CHIP8_WATCH_READ | CHIP8_WATCH_WRITE;
+			if(count >= 4)
+				kind = (strchr(arg3, 'r') ? CHIP8_WATCH_READ : 0) | (strchr(arg3, 'w') ? CHIP8_WATCH_WRITE : 0);
+			if(!chip8_debug_watch(strtoul(arg1, NULL, 16), strtoul(arg2, NULL, 16), kind))
+				printf("invalid watchpoint\n");
+		} else if(strcmp(command, "u") == 0 && count == 2){
+			chip8_debug_unwatch(strtoul(arg1, NULL, 16));
+		} else if(strcmp(command, "l") == 0){
+			print_points();
+		} else if(strcmp(command, "q") == 0){
+			exit(0);
+		} else {
+			print_help();
+		}
+	}
+}
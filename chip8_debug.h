@@ -0,0 +1,59 @@
+#ifndef __CHIP8_DEBUG_H__
+#define __CHIP8_DEBUG_H__
+
+#include "chip8.h"
+
+/*
+ * Debugger - breakpoints, watchpoints and stepping.
+ *
+ * The debugger doesn't add any checks to chip8_cycle. Instead it replaces
+ * handlers in the opcode table (chip8_set_handler) with a wrapper which does
+ * the checks and then calls the original handler. Handlers are only wrapped
+ * while something needs them: all opcodes while there are breakpoints or
+ * the machine is being stepped, memory opcodes (Dxyn, Fx33, Fx55, Fx65)
+ * while there are watchpoints. Without breakpoints the machine runs at
+ * full speed.
+ *
+ * When the machine stops, chip8_debug_prompt is entered. It reads commands
+ * from stdin until the machine should continue.
+ */
+
+#define CHIP8_DEBUG_MAX_BREAKPOINTS	32
+#define CHIP8_DEBUG_MAX_WATCHPOINTS	32
+
+/* breakpoint conditions - compare V[reg] with a value */
+#define CHIP8_COND_NONE		0
+#define CHIP8_COND_EQ		1
+#define CHIP8_COND_NE		2
+#define CHIP8_COND_LT		3
+#define CHIP8_COND_GT		4
+
+/* watchpoint kinds */
+#define CHIP8_WATCH_READ	1
+#define CHIP8_WATCH_WRITE	2
+
+/* stops before the instruction at addr is executed. returns 0 if there's no room for another breakpoint */
+int chip8_debug_break(unsigned short addr);
+
+/* stops before the instruction at addr is executed if V[reg] <cond> value holds. returns 0 on failure */
+int chip8_debug_break_if(unsigned short addr, unsigned char reg, unsigned char cond, unsigned char value);
+
+/* removes all breakpoints at addr */
+void chip8_debug_delete(unsigned short addr);
+
+/* stops before an instruction reads/writes (kind) memory in [lo, hi]. returns 0 on failure */
+int chip8_debug_watch(unsigned short lo, unsigned short hi, unsigned char kind);
+
+/* removes watchpoints which start at lo */
+void chip8_debug_unwatch(unsigned short lo);
+
+/* stops before the next instruction */
+void chip8_debug_step(void);
+
+/* interactive command interface, returns once the machine should continue */
+void chip8_debug_prompt(chip8_t* chip);
+
+/* removes all breakpoints and watchpoints and restores original handlers */
+void chip8_debug_cleanup(void);
+
+#endif
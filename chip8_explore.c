@@ -0,0 +1,670 @@
+/*
+ * chip8_explore - finds states a ROM can reach with any input.
+ *
+ * usage: chip8_explore [options] <rom>
+ *	-threads <n>		worker threads (default: one per core)
+ *	-memory <MB>		memory for states and hash sets (default 1024)
+ *	-steps <n>		frames without input after which a path is given up (default 3600)
+ *	-states <n>		stop after n distinct states (default 0 - until everything is explored)
+ *	-quirks <profile>	default, vip, schip or modern (see chip8_quirks.h)
+ *
+ * The machine runs until the next instruction reads the keyboard. There it
+ * branches: Ex9E/ExA1 with the tested key pressed and with no key pressed
+ * (other keys don't change what the instruction does), Fx0A once for each of
+ * the 16 keys. Every machine state at such a decision point is hashed and
+ * explored only the first time it is reached.
+ *
+ * Workers keep their own deque of states, take the newest one (depth first)
+ * and steal the oldest one from others when they run out. Visited states are
+ * kept in a lock-free hash set. Paths which crash (unknown instruction, call
+ * stack overflow/underflow) are printed with the keys which lead there.
+ *
+ * Hashing 64 KB of memory per state would cost more than running the machine,
+ * so the memory hash is updated by the store instructions instead - their
+ * handlers are wrapped (see chip8_wrap_handlers). For the same
+ * reason queued states are compact machines (see chip8_compact.h), every
+ * worker unpacks the state it expands into its own chip8_t.
+ */
+#define _POSIX_C_SOURCE 200112L
+#include <pthread.h>
+#include <sched.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "chip8.h"
+#include "chip8_compact.h"
+#include "chip8_cpu.h"
+#include "chip8_quirks.h"
+
+/* decisions remembered for a crash report */
+#define PATH_LENGTH	64
+/* "no key pressed" in a path */
+#define NO_KEY		0xFF
+/* distinct crashes which are reported */
+#define MAX_CRASHES	64
+
+/* why a node stopped running */
+#define END_NONE	0
+#define END_DECISION	1
+#define END_HALT	2
+#define END_STUCK	3
+#define END_UNKNOWN	4
+#define END_OVERFLOW	5
+#define END_UNDERFLOW	6
+
+/* a machine on its way to the next decision */
+typedef struct {
+	chip8_compact_t machine;
+	/* hashes of memory and gfx, kept up to date while running */
+	unsigned long memory_hash;
+	unsigned long gfx_hash;
+	unsigned long frames;
+	/* keys chosen so far, NO_KEY if none was pressed */
+	unsigned long path_length;
+	unsigned char path[PATH_LENGTH];
+} node_t;
+
+/* open addressing set of hashes, 0 marks a free slot */
+typedef struct {
+	volatile unsigned long* slots;
+	unsigned long mask;
+	unsigned long limit;
+	volatile unsigned long count;
+} set_t;
+
+typedef struct {
+	pthread_mutex_t lock;
+	node_t** nodes;
+	size_t head, count, capacity;
+} deque_t;
+
+/* the machine a worker runs. scratch has to be the first member,
+ * handlers get &scratch.chip and the wrappers below cast it back */
+typedef struct {
+	chip8_scratch_t scratch;
+	/* node which is running */
+	node_t* node;
+	/* set by handlers which change the screen */
+	unsigned char gfx_dirty;
+	unsigned char end;
+} machine_t;
+
+typedef struct {
+	pthread_t thread;
+	size_t index;
+	machine_t machine;
+	deque_t deque;
+	/* visited pc addresses, 1 bit each */
+	unsigned char pcs[CHIP_ADDRESS_SPACE / 8];
+	unsigned long cycles, duplicates, halted, stuck, crashed, pruned;
+} worker_t;
+
+static worker_t* workers;
+static size_t worker_count;
+static set_t visited, frames;
+static unsigned long max_steps = 3600;
+static unsigned long max_states = 0;
+/* nodes allocated, bytes of nodes and their pages allowed by the memory cap */
+static volatile unsigned long live = 0;
+static unsigned long max_bytes;
+/* nodes queued or being expanded, exploration is over when it drops to 0 */
+static volatile unsigned long outstanding = 0;
+static volatile sig_atomic_t stop = 0;
+
+static pthread_mutex_t crash_lock = PTHREAD_MUTEX_INITIALIZER;
+static unsigned long crash_sites[MAX_CRASHES];
+static size_t crash_count = 0;
+
+static void on_signal(int signal){
+	stop = 1;
+}
+
+/* 64 bit finalizer of MurmurHash3 */
+static unsigned long mix(unsigned long h){
+	h ^= h >> 33;
+	h *= 0xFF51AFD7ED558CCDUL;
+	h ^= h >> 33;
+	h *= 0xC4CEB9FE1A85EC53UL;
+	h ^= h >> 33;
+	return h;
+}
+
+/* share of a memory byte in memory_hash, zero bytes don't count */
+static unsigned long memory_byte(unsigned long addr, unsigned char value){
+	return value ? mix(addr << 8 | value) : 0;
+}
+
+static unsigned long hash_gfx(chip8_t* chip){
+	unsigned long h = 0, word;
+	size_t i;
+	for(i = 0; i < sizeof(chip->gfx); i += sizeof(word)){
+		memcpy(&word, chip->gfx + i, sizeof(word));
+		h = mix(h ^ word);
+	}
+	return h;
+}
+
+static unsigned long hash_state(node_t* node, chip8_t* chip){
+	unsigned long h = node->memory_hash ^ mix(node->gfx_hash);
+	int i;
+	for(i = 0; i < CHIP_REGISTER_COUNT; ++i)
+		h = mix(h ^ chip->V[i]);
+	/* entries above sp are overwritten before they're read */
+	for(i = 1; i <= chip->sp; ++i)
+		h = mix(h ^ chip->stack[i]);
+	h = mix(h ^ chip->I ^ (unsigned long)chip->pc << 16 ^ (unsigned long)chip->sp << 32);
+	h = mix(h ^ chip->delay_timer ^ chip->sound_timer << 8 ^ (unsigned long)chip->waiting_keypress << 16);
+	return mix(h ^ chip->random);
+}
+
+/* returns 1 if the hash was added, 0 if it's in the set already, -1 if the set is full */
+static int set_add(set_t* set, unsigned long h){
+	unsigned long i, slot;
+	if(h == 0)
+		h = 1;
+	for(i = h & set->mask; ; i = (i + 1) & set->mask){
+		slot = set->slots[i];
+		if(slot == h)
+			return 0;
+		if(slot != 0)
+			continue;
+		if(set->count >= set->limit)
+			return -1;
+		if(__sync_bool_compare_and_swap(&set->slots[i], 0, h)){
+			__sync_fetch_and_add(&set->count, 1);
+			return 1;
+		}
+		/* somebody else took the slot, it may be the same hash */
+		if(set->slots[i] == h)
+			return 0;
+	}
+}
+
+/* set of at most max_bytes, returns 0 on failure */
+static int set_init(set_t* set, unsigned long max_bytes){
+	unsigned long size = 1024;
+	while(size * 2 * sizeof(unsigned long) <= max_bytes)
+		size *= 2;
+	set->slots = calloc(size, sizeof(unsigned long));
+	set->mask = size - 1;
+	/* probing gets slow when the table is almost full */
+	set->limit = size / 4 * 3;
+	set->count = 0;
+	return set->slots != NULL;
+}
+
+static int push(deque_t* deque, node_t* node){
+	node_t** nodes;
+	int result = 1;
+	pthread_mutex_lock(&deque->lock);
+	if(deque->head + deque->count == deque->capacity){
+		if(deque->head > 0){
+			memmove(deque->nodes, deque->nodes + deque->head, deque->count * sizeof(node_t*));
+			deque->head = 0;
+		} else {
+			nodes = realloc(deque->nodes, (deque->capacity * 2 + 16) * sizeof(node_t*));
+			if(nodes != NULL){
+				deque->nodes = nodes;
+				deque->capacity = deque->capacity * 2 + 16;
+			} else {
+				result = 0;
+			}
+		}
+	}
+	if(result)
+		deque->nodes[deque->head + deque->count++] = node;
+	pthread_mutex_unlock(&deque->lock);
+	return result;
+}
+
+/* the newest node - the owner goes depth first */
+static node_t* pop(deque_t* deque){
+	node_t* node = NULL;
+	pthread_mutex_lock(&deque->lock);
+	if(deque->count > 0)
+		node = deque->nodes[deque->head + --deque->count];
+	pthread_mutex_unlock(&deque->lock);
+	return node;
+}
+
+/* the oldest node - it's closest to the root, so most work is likely behind it */
+static node_t* steal(deque_t* deque){
+	node_t* node = NULL;
+	pthread_mutex_lock(&deque->lock);
+	if(deque->count > 0){
+		node = deque->nodes[deque->head++];
+		--deque->count;
+	}
+	pthread_mutex_unlock(&deque->lock);
+	return node;
+}
+
+static node_t* new_node(node_t* from){
+	node_t* node;
+	/* pages are counted as they are, stores after this may go a few pages over */
+	if(__sync_add_and_fetch(&live, 1) * sizeof(node_t) + chip8_compact_bytes() > max_bytes){
+		__sync_fetch_and_sub(&live, 1);
+		return NULL;
+	}
+	node = malloc(sizeof(node_t));
+	if(node == NULL){
+		__sync_fetch_and_sub(&live, 1);
+		return NULL;
+	}
+	memcpy(node, from, sizeof(node_t));
+	if(!chip8_compact_copy(&node->machine, &from->machine)){
+		free(node);
+		__sync_fetch_and_sub(&live, 1);
+		return NULL;
+	}
+	return node;
+}
+
+static void free_node(node_t* node){
+	chip8_compact_free(&node->machine);
+	free(node);
+	__sync_fetch_and_sub(&live, 1);
+}
+
+static unsigned short peek(chip8_t* chip){
+	return chip->memory[chip->pc] << 8 | chip->memory[chip->pc + 1];
+}
+
+/* Ex9E, ExA1 and Fx0A */
+static int is_decision(unsigned short opcode){
+	return (opcode & 0xF0FF) == 0xE09E || (opcode & 0xF0FF) == 0xE0A1 || (opcode & 0xF0FF) == 0xF00A;
+}
+
+static void unknown_handler(chip8_t* chip, opcode_params_t* params){
+	((machine_t*)chip)->end = END_UNKNOWN;
+}
+
+static void call_handler(chip8_t* chip, opcode_params_t* params){
+	/* callsub increments sp before it stores to the stack */
+	if(chip->sp >= CHIP_STACK_DEPTH - 1){
+		((machine_t*)chip)->end = END_OVERFLOW;
+		return;
+	}
+	chip8_call_wrapped(call_handler, chip, params);
+}
+
+static void return_handler(chip8_t* chip, opcode_params_t* params){
+	if(chip->sp == 0){
+		((machine_t*)chip)->end = END_UNDERFLOW;
+		return;
+	}
+	chip8_call_wrapped(return_handler, chip, params);
+}
+
+/* Fx33, Fx55 - updates memory_hash with the bytes which changed */
+static void store_handler(chip8_t* chip, opcode_params_t* params){
+	node_t* node = ((machine_t*)chip)->node;
+	unsigned long addr = chip->I, i;
+	unsigned char before[CHIP_ADDRESS_GUARD];
+
+	memcpy(before, chip->memory + addr, sizeof(before));
+	chip8_call_wrapped(store_handler, chip, params);
+	for(i = 0; i < sizeof(before); ++i){
+		if(before[i] != chip->memory[addr + i])
+			node->memory_hash ^= memory_byte(addr + i, before[i]) ^ memory_byte(addr + i, chip->memory[addr + i]);
+	}
+}
+
+/* 00E0, Dxyn */
+static void gfx_handler(chip8_t* chip, opcode_params_t* params){
+	chip8_call_wrapped(gfx_handler, chip, params);
+	((machine_t*)chip)->gfx_dirty = 1;
+}
+
+/* returns 0 on failure */
+static int wrap_handlers(void){
+	return chip8_wrap_unknown(unknown_handler)
+		&& chip8_wrap_handlers(0xF000, 0x2000, call_handler)
+		&& chip8_wrap_handlers(0xFFFF, 0x00EE, return_handler)
+		&& chip8_wrap_handlers(0xF0FF, 0xF033, store_handler)
+		&& chip8_wrap_handlers(0xF0FF, 0xF055, store_handler)
+		&& chip8_wrap_handlers(0xFFFF, 0x00E0, gfx_handler)
+		&& chip8_wrap_handlers(0xF000, 0xD000, gfx_handler);
+}
+
+/* runs one instruction */
+static void step(worker_t* worker, node_t* node){
+	chip8_t* chip = &worker->machine.scratch.chip;
+	worker->pcs[chip->pc / 8] |= 1 << (chip->pc % 8);
+	chip8_cycle(chip);
+	++worker->cycles;
+	++node->frames;
+	if(worker->machine.gfx_dirty){
+		worker->machine.gfx_dirty = 0;
+		node->gfx_hash = hash_gfx(chip);
+		set_add(&frames, node->gfx_hash);
+	}
+}
+
+/* runs the machine until the next decision or until its path ends */
+static void run(worker_t* worker, node_t* node){
+	chip8_t* chip = &worker->machine.scratch.chip;
+	unsigned short opcode;
+	unsigned long steps;
+
+	for(steps = 0; steps < max_steps; ++steps){
+		opcode = peek(chip);
+		if(is_decision(opcode)){
+			worker->machine.end = END_DECISION;
+			return;
+		}
+		/* a jump to itself - the usual way to stop */
+		if(opcode == (0x1000 | chip->pc)){
+			worker->machine.end = END_HALT;
+			return;
+		}
+		step(worker, node);
+		if(worker->machine.end != END_NONE)
+			return;
+	}
+	worker->machine.end = END_STUCK;
+}
+
+static void report_crash(node_t* node, chip8_t* chip, unsigned char end){
+	static const char* reasons[] = {"unknown instruction", "call stack overflow", "return with empty stack"};
+	unsigned short pc = chip->pc - 2;
+	unsigned long site = (unsigned long)end << 16 | pc, i;
+
+	pthread_mutex_lock(&crash_lock);
+	for(i = 0; i < crash_count; ++i){
+		if(crash_sites[i] == site)
+			break;
+	}
+	if(i == crash_count && crash_count < MAX_CRASHES){
+		crash_sites[crash_count++] = site;
+		printf("crash: %s at %03hx (%04hx) after %lu frames, keys:", reasons[end - END_UNKNOWN],
+			pc, chip->opcode, node->frames);
+		for(i = 0; i < node->path_length && i < PATH_LENGTH; ++i){
+			if(node->path[i] == NO_KEY)
+				printf(" -");
+			else
+				printf(" %X", node->path[i]);
+		}
+		printf("%s\n", node->path_length > PATH_LENGTH ? " ..." : "");
+		fflush(stdout);
+	}
+	pthread_mutex_unlock(&crash_lock);
+}
+
+/* queues a node which reached a decision, frees the rest */
+static void finish(worker_t* worker, node_t* node){
+	chip8_t* chip = &worker->machine.scratch.chip;
+	int added;
+	switch(worker->machine.end){
+	case END_DECISION:
+		added = set_add(&visited, hash_state(node, chip));
+		if(added > 0 && !chip8_compact_store(&worker->machine.scratch, &node->machine))
+			added = -1;
+		if(added > 0){
+			__sync_fetch_and_add(&outstanding, 1);
+			if(max_states > 0 && visited.count >= max_states)
+				stop = 1;
+			if(push(&worker->deque, node))
+				return;
+			__sync_fetch_and_sub(&outstanding, 1);
+			++worker->pruned;
+		} else if(added == 0){
+			++worker->duplicates;
+		} else {
+			++worker->pruned;
+		}
+		break;
+	case END_HALT:
+		++worker->halted;
+		break;
+	case END_STUCK:
+		++worker->stuck;
+		break;
+	default:
+		++worker->crashed;
+		report_crash(node, chip, worker->machine.end);
+		break;
+	}
+	free_node(node);
+}
+
+static void remember_key(node_t* node, unsigned char key){
+	if(node->path_length < PATH_LENGTH)
+		node->path[node->path_length] = key;
+	++node->path_length;
+}
+
+/*
+ * the key arrives like in chipm8, and the wait is finished right away like
+ * chip8_cycle would before the next instruction - so that the key is in V[x]
+ * when the state is hashed and when a decision right after it reads V[x]
+ */
+static void press_key(chip8_t* chip, unsigned char key){
+	chip->last_pressed = key;
+	chip->V[(chip->opcode & 0x0F00) >> 8] = key;
+	chip->waiting_keypress = 0;
+}
+
+/* runs every choice of keys from a decision */
+static void expand(worker_t* worker, node_t* node){
+	machine_t* machine = &worker->machine;
+	chip8_t* chip = &machine->scratch.chip;
+	unsigned short opcode;
+	unsigned char key;
+	int choices, choice;
+	node_t* child;
+
+	chip8_compact_load(&machine->scratch, &node->machine);
+	opcode = peek(chip);
+	key = chip->V[(opcode & 0x0F00) >> 8] & 0xF;
+	choices = (opcode & 0xF0FF) == 0xF00A ? CHIP_KEYS_COUNT : 2;
+	for(choice = 0; choice < choices; ++choice){
+		/* the last choice continues in the node itself */
+		child = choice == choices - 1 ? node : new_node(node);
+		if(child == NULL){
+			++worker->pruned;
+			continue;
+		}
+		if(choice > 0)
+			chip8_compact_load(&machine->scratch, &node->machine);
+		machine->node = child;
+		machine->end = END_NONE;
+		if(choices == CHIP_KEYS_COUNT){
+			/* Fx0A waits, then the key arrives */
+			step(worker, child);
+			press_key(chip, choice);
+			remember_key(child, choice);
+		} else {
+			chip->keys[key] = choice == 0;
+			step(worker, child);
+			chip->keys[key] = 0;
+			remember_key(child, choice == 0 ? key : NO_KEY);
+		}
+		if(machine->end == END_NONE)
+			run(worker, child);
+		finish(worker, child);
+	}
+}
+
+static void* worker_main(void* userdata){
+	worker_t* worker = userdata;
+	node_t* node;
+	size_t i;
+
+	while(!stop){
+		node = pop(&worker->deque);
+		for(i = 1; node == NULL && i < worker_count; ++i)
+			node = steal(&workers[(worker->index + i) % worker_count].deque);
+		if(node == NULL){
+			if(__sync_fetch_and_add(&outstanding, 0) == 0)
+				break;
+			sched_yield();
+			continue;
+		}
+		expand(worker, node);
+		__sync_fetch_and_sub(&outstanding, 1);
+	}
+	return NULL;
+}
+
+/* loads program from file, returns 0 on failure */
+static size_t load_program(const char* filename, unsigned char* whereToLoad, size_t max_length){
+	size_t result;
+	FILE* file = fopen(filename, "rb");
+	if(file == NULL)
+		return 0;
+	result = fread(whereToLoad, sizeof(char), max_length, file);
+	fclose(file);
+	return result;
+}
+
+static void usage(const char* name){
+	fprintf(stderr, "usage: %s [-threads n] [-memory MB] [-steps n] [-states n] [-quirks profile] <rom>\n", name);
+}
+
+int main(int argc, char** argv){
+	unsigned char program[CHIP_MEMORY_SIZE - CHIP_PROGRAM_OFFSET];
+	size_t program_length;
+	const char* rom = NULL;
+	unsigned long memory = 1024, cycles = 0, duplicates = 0, halted = 0, stuck = 0, crashed = 0, pruned = 0;
+	unsigned long addr, pcs = 0;
+	struct timespec start, end;
+	double seconds;
+	node_t* root;
+	chip8_t* initial;
+	chip8_image_t* image;
+	node_t* node;
+	size_t w;
+	long cores;
+	int i;
+
+	cores = sysconf(_SC_NPROCESSORS_ONLN);
+	worker_count = cores > 0 ? cores : 1;
+	for(i = 1; i < argc; ++i){
+		if(strcmp(argv[i], "-threads") == 0 && i + 1 < argc){
+			worker_count = strtoul(argv[++i], NULL, 10);
+		} else if(strcmp(argv[i], "-memory") == 0 && i + 1 < argc){
+			memory = strtoul(argv[++i], NULL, 10);
+		} else if(strcmp(argv[i], "-steps") == 0 && i + 1 < argc){
+			max_steps = strtoul(argv[++i], NULL, 10);
+		} else if(strcmp(argv[i], "-states") == 0 && i + 1 < argc){
+			max_states = strtoul(argv[++i], NULL, 10);
+		} else if(strcmp(argv[i], "-quirks") == 0 && i + 1 < argc){
+			if(!chip8_select_quirks(chip8_quirks_by_name(argv[++i]))){
+				usage(argv[0]);
+				return 1;
+			}
+		} else if(argv[i][0] != '-' && rom == NULL){
+			rom = argv[i];
+		} else {
+			usage(argv[0]);
+			return 1;
+		}
+	}
+	if(rom == NULL || worker_count == 0){
+		usage(argv[0]);
+		return 1;
+	}
+	program_length = load_program(rom, program, sizeof(program));
+	if(program_length == 0){
+		fprintf(stderr, "Error: Unable to load %s\n", rom);
+		return 1;
+	}
+
+	/* an eighth of the memory for visited states, a 32nd for frames, the rest for queued states */
+	memory <<= 20;
+	if(!set_init(&visited, memory / 8) || !set_init(&frames, memory / 32)){
+		fprintf(stderr, "Error: Out of memory\n");
+		return 1;
+	}
+	/* every worker needs room for the node it expands and one child */
+	if(memory < (visited.mask + 1 + frames.mask + 1) * sizeof(unsigned long) + 2 * worker_count * sizeof(node_t)){
+		fprintf(stderr, "Error: -memory is too small for %lu threads\n", (unsigned long)worker_count);
+		return 1;
+	}
+	workers = calloc(worker_count, sizeof(worker_t));
+	root = calloc(1, sizeof(node_t));
+	initial = malloc(sizeof(chip8_t));
+	if(workers == NULL || root == NULL || initial == NULL){
+		fprintf(stderr, "Error: Out of memory\n");
+		return 1;
+	}
+	max_bytes = memory - (visited.mask + 1 + frames.mask + 1) * sizeof(unsigned long);
+	live = 1;
+
+	if(!chip8_compact_track_writes() || !wrap_handlers()){
+		fprintf(stderr, "Error: Unable to wrap handlers\n");
+		return 1;
+	}
+	chip8_init(initial);
+	chip8_load(initial, program, program_length);
+	image = chip8_image_create(initial);
+	if(image == NULL){
+		fprintf(stderr, "Error: Out of memory\n");
+		return 1;
+	}
+	for(addr = 0; addr < sizeof(initial->memory); ++addr)
+		root->memory_hash ^= memory_byte(addr, initial->memory[addr]);
+	root->gfx_hash = hash_gfx(initial);
+	set_add(&frames, root->gfx_hash);
+	chip8_scratch_init(&workers[0].machine.scratch, initial, image);
+	workers[0].machine.node = root;
+	free(initial);
+	for(w = 0; w < worker_count; ++w){
+		workers[w].index = w;
+		pthread_mutex_init(&workers[w].deque.lock, NULL);
+	}
+
+	signal(SIGINT, on_signal);
+	signal(SIGTERM, on_signal);
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	run(&workers[0], root);
+	finish(&workers[0], root);
+	for(w = 0; w < worker_count; ++w){
+		if(pthread_create(&workers[w].thread, NULL, worker_main, &workers[w]) != 0){
+			fprintf(stderr, "Error: Unable to start a thread\n");
+			return 1;
+		}
+	}
+	for(w = 0; w < worker_count; ++w)
+		pthread_join(workers[w].thread, NULL);
+	clock_gettime(CLOCK_MONOTONIC, &end);
+	seconds = (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) / 1e9;
+
+	/* merge what the workers found */
+	for(w = 0; w < worker_count; ++w){
+		while((node = pop(&workers[w].deque)) != NULL)
+			free_node(node);
+		for(addr = 0; w > 0 && addr < sizeof(workers[w].pcs); ++addr)
+			workers[0].pcs[addr] |= workers[w].pcs[addr];
+		cycles += workers[w].cycles;
+		duplicates += workers[w].duplicates;
+		halted += workers[w].halted;
+		stuck += workers[w].stuck;
+		crashed += workers[w].crashed;
+		pruned += workers[w].pruned;
+		free(workers[w].deque.nodes);
+		pthread_mutex_destroy(&workers[w].deque.lock);
+	}
+	for(addr = 0; addr < CHIP_ADDRESS_SPACE; ++addr){
+		if(workers[0].pcs[addr / 8] & (1 << (addr % 8)))
+			++pcs;
+	}
+
+	printf("%s%lu states in %.2f s (%.0f states/s, %.0f cycles/s), %lu duplicates\n",
+		stop ? "interrupted, " : "", visited.count, seconds,
+		seconds > 0 ? visited.count / seconds : 0.0, seconds > 0 ? cycles / seconds : 0.0, duplicates);
+	printf("coverage: %lu instruction addresses, %lu distinct frames\n", pcs, frames.count);
+	printf("paths: %lu halted, %lu stuck for %lu frames, %lu crashed, %lu pruned (memory cap)\n",
+		halted, stuck, max_steps, crashed, pruned);
+
+	chip8_image_free(image);
+	free((void*)visited.slots);
+	free((void*)frames.slots);
+	free(workers);
+	return 0;
+}
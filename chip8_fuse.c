@@ -0,0 +1,209 @@
+#include "chip8_fuse.h"
+#include "chip8_cpu.h"
+#include <string.h>
+
+/* kinds of cache entries */
+#define CHIP8_FUSE_UNKNOWN	0
+#define CHIP8_FUSE_SINGLE	1
+/* single Fx33/Fx55 - invalidates entries it writes over */
+#define CHIP8_FUSE_STORE	2
+#define CHIP8_FUSE_TIMER_POLL	3
+#define CHIP8_FUSE_DRAW		4
+#define CHIP8_FUSE_TIMER_SET	5
+#define CHIP8_FUSE_KEY_POLL	6
+
+#define X(opcode)	(((opcode) & 0x0F00) >> 8)
+#define KK(opcode)	((opcode) & 0x00FF)
+#define NNN(opcode)	((opcode) & 0x0FFF)
+
+/* what chip8_cycle does before a handler */
+static void begin(chip8_t* chip, unsigned short opcode){
+	chip->opcode = opcode;
+	chip->pc += 2;
+}
+
+static unsigned short fetch(chip8_t* chip, unsigned short addr){
+	return chip->memory[addr] << 8 | chip->memory[addr + 1];
+}
+
+static void decode(chip8_t* chip, chip8_fused_t* entry, unsigned short addr){
+	unsigned short a = fetch(chip, addr), b = fetch(chip, addr + 2), c = fetch(chip, addr + 4);
+
+	entry->opcodes[0] = a;
+	entry->opcodes[1] = b;
+	entry->opcodes[2] = c;
+	entry->length = 1;
+	entry->kind = CHIP8_FUSE_SINGLE;
+	if((a & 0xF0FF) == 0xF033 || (a & 0xF0FF) == 0xF055){
+		entry->kind = CHIP8_FUSE_STORE;
+	} else if((a & 0xF0FF) == 0xF007 && ((b & 0xF000) == 0x3000 || (b & 0xF000) == 0x4000)
+			&& X(a) == X(b) && (c & 0xF000) == 0x1000){
+		entry->kind = CHIP8_FUSE_TIMER_POLL;
+		entry->length = 3;
+	} else if((a & 0xF000) == 0xA000 && (b & 0xF000) == 0xD000){
+		entry->kind = CHIP8_FUSE_DRAW;
+		entry->length = 2;
+	} else if((a & 0xF000) == 0x6000 && ((b & 0xF0FF) == 0xF015 || (b & 0xF0FF) == 0xF018) && X(a) == X(b)){
+		entry->kind = CHIP8_FUSE_TIMER_SET;
+		entry->length = 2;
+	} else if(((a & 0xF0FF) == 0xE09E || (a & 0xF0FF) == 0xE0A1) && (b & 0xF000) == 0x1000){
+		entry->kind = CHIP8_FUSE_KEY_POLL;
+		entry->length = 2;
+	}
+}
+
+/* drops entries which may have read memory in [lo, hi] */
+static void invalidate(chip8_fuse_t* fuse, unsigned long lo, unsigned long hi){
+	unsigned long addr;
+	lo = lo >= 2 * CHIP8_FUSE_MAX_LENGTH - 1 ? lo - (2 * CHIP8_FUSE_MAX_LENGTH - 1) : 0;
+	for(addr = lo; addr <= hi && addr < CHIP_MEMORY_SIZE; ++addr)
+		fuse->entries[addr].kind = CHIP8_FUSE_UNKNOWN;
+}
+
+/* runs an instruction by chip8_cycle, drops entries which it may have written over */
+static void step(chip8_t* chip, chip8_fuse_t* fuse){
+	unsigned short addr = chip->I, opcode = fetch(chip, chip->pc);
+	/* a machine which waits for a key doesn't run anything */
+	int runs = chip->waiting_keypress != 1;
+	chip8_cycle(chip);
+	if(runs && ((opcode & 0xF0FF) == 0xF033 || (opcode & 0xF0FF) == 0xF055))
+		invalidate(fuse, addr, (unsigned long)addr + CHIP_ADDRESS_GUARD - 1);
+}
+
+/* Fx07 3xkk/4xkk 1nnn */
+static long timer_poll(chip8_t* chip, const chip8_fused_t* entry){
+	unsigned char x = X(entry->opcodes[0]), kk = KK(entry->opcodes[1]);
+	int skip;
+
+	begin(chip, entry->opcodes[0]);
+	chip->V[x] = chip->delay_timer;
+	chip8_update_timers(chip);
+
+	begin(chip, entry->opcodes[1]);
+	skip = (entry->opcodes[1] & 0xF000) == 0x3000 ? chip->V[x] == kk : chip->V[x] != kk;
+	chip8_update_timers(chip);
+	if(skip){
+		chip->pc += 2;
+		return 2;
+	}
+
+	begin(chip, entry->opcodes[2]);
+	chip->pc = NNN(entry->opcodes[2]);
+	chip8_update_timers(chip);
+	return 3;
+}
+
+/* Annn Dxyn */
+static long draw(chip8_t* chip, const chip8_fused_t* entry){
+	unsigned short opcode = entry->opcodes[1];
+	opcode_params_t params;
+
+	begin(chip, entry->opcodes[0]);
+	chip->I = NNN(entry->opcodes[0]);
+	chip8_update_timers(chip);
+
+	/* the quirk profile decides how to draw */
+	begin(chip, opcode);
+	params.nnn = NNN(opcode);
+	params.nn = KK(opcode);
+	params.x = X(opcode);
+	params.y = (opcode & 0x00F0) >> 4;
+	params.n = opcode & 0x000F;
+	chip8_get_handler(opcode)(chip, &params);
+	chip8_update_timers(chip);
+	return 2;
+}
+
+/* 6xkk Fx15/Fx18 */
+static long timer_set(chip8_t* chip, const chip8_fused_t* entry){
+	unsigned char x = X(entry->opcodes[0]);
+
+	begin(chip, entry->opcodes[0]);
+	chip->V[x] = KK(entry->opcodes[0]);
+	chip8_update_timers(chip);
+
+	begin(chip, entry->opcodes[1]);
+	if((entry->opcodes[1] & 0x00FF) == 0x15)
+		chip->delay_timer = chip->V[x];
+	else
+		chip->sound_timer = chip->V[x];
+	chip8_update_timers(chip);
+	return 2;
+}
+
+/* Ex9E/ExA1 1nnn */
+static long key_poll(chip8_t* chip, const chip8_fused_t* entry){
+	unsigned char key = chip->V[X(entry->opcodes[0])] & 0xF;
+	int skip;
+
+	begin(chip, entry->opcodes[0]);
+	skip = (entry->opcodes[0] & 0x00FF) == 0x9E ? chip->keys[key] == 1 : chip->keys[key] == 0;
+	chip8_update_timers(chip);
+	if(skip){
+		chip->pc += 2;
+		return 1;
+	}
+
+	begin(chip, entry->opcodes[1]);
+	chip->pc = NNN(entry->opcodes[1]);
+	chip8_update_timers(chip);
+	return 2;
+}
+
+void chip8_fuse_reset(chip8_fuse_t* fuse){
+	memset(fuse, 0, sizeof(chip8_fuse_t));
+}
+
+long chip8_fuse_run(chip8_t* chip, chip8_fuse_t* fuse, long budget){
+	chip8_fused_t* entry;
+	long done = 0, ran;
+
+	while(done < budget){
+		/* chip8_cycle takes care of key presses, the caller may have to deliver one.
+		 * after a key press it runs the next instruction as well, which may be a store */
+		if(chip->waiting_keypress != 0 || chip->pc >= CHIP_MEMORY_SIZE){
+			step(chip, fuse);
+			++done;
+			++fuse->instructions;
+			if(chip->waiting_keypress == 1)
+				break;
+			continue;
+		}
+		entry = &fuse->entries[chip->pc];
+		if(entry->kind == CHIP8_FUSE_UNKNOWN)
+			decode(chip, entry, chip->pc);
+		if(entry->length > budget - done){
+			/* the whole sequence doesn't fit, run its first instruction alone */
+			chip8_cycle(chip);
+			ran = 1;
+		} else switch(entry->kind){
+		case CHIP8_FUSE_STORE:
+			step(chip, fuse);
+			ran = 1;
+			break;
+		case CHIP8_FUSE_TIMER_POLL:
+			ran = timer_poll(chip, entry);
+			break;
+		case CHIP8_FUSE_DRAW:
+			ran = draw(chip, entry);
+			break;
+		case CHIP8_FUSE_TIMER_SET:
+			ran = timer_set(chip, entry);
+			break;
+		case CHIP8_FUSE_KEY_POLL:
+			ran = key_poll(chip, entry);
+			break;
+		default:
+			chip8_cycle(chip);
+			ran = 1;
+			break;
+		}
+		if(entry->length > 1 && ran > 1)
+			++fuse->fused;
+		done += ran;
+		fuse->instructions += ran;
+		if(chip->waiting_keypress == 1)
+			break;
+	}
+	return done;
+}
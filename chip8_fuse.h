@@ -0,0 +1,57 @@
+#ifndef __CHIP8_FUSE_H__
+#define __CHIP8_FUSE_H__
+
+#include "chip8.h"
+
+/*
+ * Superinstructions - common sequences of instructions run by one handler.
+ *
+ *	Fx07 3xkk/4xkk 1nnn	timer poll
+ *	Annn Dxyn		sprite draw
+ *	6xkk Fx15/Fx18		timer set
+ *	Ex9E/ExA1 1nnn		key poll
+ *
+ * The first time an address is run, the code there is decoded into a cache
+ * entry, which is either one of the sequences above or a single instruction.
+ * A superinstruction does exactly what the instructions would do one by one,
+ * including the timer tick (and the frame callback) after each of them, so it
+ * only saves fetching, decoding and dispatching the instructions.
+ *
+ * Entries are dropped when Fx33/Fx55 writes over them (or up to 5 bytes
+ * before them, where a sequence reaching the written bytes may start). Other
+ * changes of memory need chip8_fuse_reset. Only the first CHIP_MEMORY_SIZE
+ * bytes are cached, code above runs one instruction at a time.
+ *
+ * Handlers installed with chip8_set_handler are bypassed by superinstructions,
+ * except for Dxyn, so don't mix this with the debugger.
+ */
+
+/* the longest sequence */
+#define CHIP8_FUSE_MAX_LENGTH	3
+
+typedef struct {
+	/* CHIP8_FUSE_* kind, 0 if the address wasn't decoded yet */
+	unsigned char kind;
+	/* instructions in the sequence */
+	unsigned char length;
+	unsigned short opcodes[CHIP8_FUSE_MAX_LENGTH];
+} chip8_fused_t;
+
+typedef struct {
+	chip8_fused_t entries[CHIP_MEMORY_SIZE];
+	/* superinstructions run so far, to see how much fusion helped */
+	unsigned long fused;
+	/* instructions run so far */
+	unsigned long instructions;
+} chip8_fuse_t;
+
+/* empties the cache - call it when the machine is (re)loaded */
+void chip8_fuse_reset(chip8_fuse_t* fuse);
+
+/*
+ * runs at most budget instructions (frames), returns how many ran.
+ * returns early once the machine waits for a key press
+ */
+long chip8_fuse_run(chip8_t* chip, chip8_fuse_t* fuse, long budget);
+
+#endif
@@ -0,0 +1,333 @@
+/*
+ * chip8_fuzz - runs untrusted ROMs and key presses, as a fuzzing target.
+ *
+ * usage: chip8_fuzz [file...]
+ *	runs every file (stdin without files) once and prints how far it got
+ *	and which handlers ran. CHIP8_FUZZ_QUIRKS=<profile> picks the quirk profile,
+ *	CHIP8_FUZZ_CYCLES=<n> the instructions an input may run (default 250).
+ *
+ * Input: byte 0 is the number of key events, then 2 bytes per event - frames
+ * to wait after the previous event and the key (bit 7 set - press, clear -
+ * release, low 4 bits - the key). The rest is the ROM. A run ends after
+ * CHIP8_FUZZ_CYCLES cycles, on an unknown instruction, or when the machine
+ * jumps to itself / waits for a key and no more events are left.
+ *
+ * Most ROMs loop, so most inputs use the whole budget and it sets the speed:
+ * at -O2 about 300k inputs/s with 250 cycles, 70k/s with 1000. A larger budget
+ * gets deeper into ROMs which take long to set up, at that cost.
+ *
+ * The same machine runs every input, so it isn't reinitialized: the store
+ * handlers mark memory pages they write and the drawing handlers mark rows of
+ * the screen, and only these (and the pages of the ROM) are reset afterwards.
+ *
+ * Coverage of the core comes from the compiler's instrumentation. On top of it,
+ * every pair of handlers which ran one after another is counted in coverage[],
+ * which libFuzzer reads as extra counters.
+ *
+ * libFuzzer:	clang -DCHIP8_FUZZ_LIBFUZZER -fsanitize=fuzzer,address chip8_fuzz.c chip8.c chip8_impl.c chip8_cpu.c chip8_quirks.c
+ * AFL:		CC=afl-clang-fast make chip8_fuzz (runs in persistent mode, reads inputs from stdin)
+ */
+#define _POSIX_C_SOURCE 200112L
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "chip8.h"
+#include "chip8_compact.h"
+#include "chip8_cpu.h"
+#include "chip8_quirks.h"
+
+/* instructions an input may run, unless CHIP8_FUZZ_CYCLES is set in the environment */
+#ifndef CHIP8_FUZZ_CYCLES
+#define CHIP8_FUZZ_CYCLES	250
+#endif
+
+#define MAX_ROM		(CHIP_MEMORY_SIZE - CHIP_PROGRAM_OFFSET)
+#define MAX_INPUT	(1 + 2 * 255 + MAX_ROM)
+/* distinct handlers in an opcode table, there are about 40 */
+#define MAX_HANDLERS	64
+
+static chip8_t chip;
+/* the machine after chip8_init, which every input starts from */
+static chip8_t initial;
+
+/* pages which differ from initial.memory */
+static unsigned char page_dirty[CHIP8_PAGE_COUNT];
+static unsigned short dirty_pages[CHIP8_PAGE_COUNT];
+static size_t dirty_count = 0;
+/* rows of the screen which may have a pixel set, 1 bit per row */
+static unsigned long dirty_rows = 0;
+
+static long max_cycles = CHIP8_FUZZ_CYCLES;
+
+/* set by the handler of unknown instructions */
+static int stopped;
+
+/* number of the handler of every opcode, and an opcode it handles */
+static unsigned char handler_index[65536];
+static unsigned short handler_opcode[MAX_HANDLERS];
+static size_t handler_count = 0;
+
+/* times handler b ran right after handler a, at [a * MAX_HANDLERS + b] */
+#ifdef CHIP8_FUZZ_LIBFUZZER
+__attribute__((section("__libfuzzer_extra_counters")))
+#endif
+static unsigned char coverage[MAX_HANDLERS * MAX_HANDLERS];
+
+static void mark_pages(unsigned long lo, unsigned long hi){
+	unsigned long number;
+	for(number = lo / CHIP8_PAGE_SIZE; number <= hi / CHIP8_PAGE_SIZE; ++number){
+		if(!page_dirty[number]){
+			page_dirty[number] = 1;
+			dirty_pages[dirty_count++] = number;
+		}
+	}
+}
+
+/* Fx33, Fx55 */
+static void store_handler(chip8_t* chip, opcode_params_t* params){
+	mark_pages(chip->I, (unsigned long)chip->I + CHIP_ADDRESS_GUARD - 1);
+	chip8_call_wrapped(store_handler, chip, params);
+}
+
+/* Dxyn - both profiles draw inside n rows from Vy, wrapping around */
+static void draw_handler(chip8_t* chip, opcode_params_t* params){
+	unsigned short row = chip->V[params->y] % CHIP_GFX_HEIGHT, i;
+	for(i = 0; i < params->n; ++i)
+		dirty_rows |= 1UL << ((row + i) % CHIP_GFX_HEIGHT);
+	chip8_call_wrapped(draw_handler, chip, params);
+}
+
+/* 00E0 */
+static void clear_handler(chip8_t* chip, opcode_params_t* params){
+	chip8_call_wrapped(clear_handler, chip, params);
+	dirty_rows = 0;
+}
+
+static void unknown_handler(chip8_t* chip, opcode_params_t* params){
+	stopped = 1;
+}
+
+/* numbers the handlers of the quirk profile, before they're wrapped */
+static void index_handlers(void){
+	unsigned long opcode;
+	chip8_handler_t handler;
+	size_t i;
+
+	for(opcode = 0; opcode < 65536; ++opcode){
+		handler = chip8_get_handler(opcode);
+		for(i = 0; i < handler_count && chip8_get_handler(handler_opcode[i]) != handler; ++i);
+		if(i == handler_count && handler_count < MAX_HANDLERS)
+			handler_opcode[handler_count++] = opcode;
+		handler_index[opcode] = i < MAX_HANDLERS ? i : MAX_HANDLERS - 1;
+	}
+}
+
+/* returns 0 on failure */
+static int wrap_handlers(void){
+	return chip8_wrap_unknown(unknown_handler)
+		&& chip8_wrap_handlers(0xF0FF, 0xF033, store_handler)
+		&& chip8_wrap_handlers(0xF0FF, 0xF055, store_handler)
+		&& chip8_wrap_handlers(0xF000, 0xD000, draw_handler)
+		&& chip8_wrap_handlers(0xFFFF, 0x00E0, clear_handler);
+}
+
+static void setup(void){
+	const char* quirks = getenv("CHIP8_FUZZ_QUIRKS");
+	const char* cycles = getenv("CHIP8_FUZZ_CYCLES");
+	if(cycles != NULL && (max_cycles = atol(cycles)) <= 0){
+		fprintf(stderr, "Invalid CHIP8_FUZZ_CYCLES %s\n", cycles);
+		exit(1);
+	}
+	if(quirks != NULL && !chip8_select_quirks(chip8_quirks_by_name(quirks))){
+		fprintf(stderr, "Unknown quirk profile %s\n", quirks);
+		exit(1);
+	}
+	index_handlers();
+	if(!wrap_handlers()){
+		fprintf(stderr, "Unable to wrap handlers\n");
+		exit(1);
+	}
+	chip8_init(&initial);
+	chip = initial;
+}
+
+/* copies bytes lo .. hi - 1 of the machine */
+static void copy_bytes(chip8_t* to, const chip8_t* from, size_t lo, size_t hi){
+	if(lo < hi)
+		memcpy((unsigned char*)to + lo, (const unsigned char*)from + lo, hi - lo);
+}
+
+/* copies everything except memory and gfx, wherever they are in chip8_t, so that no field is left over */
+static void copy_registers(chip8_t* to, const chip8_t* from){
+	size_t memory_lo = offsetof(chip8_t, memory), memory_hi = memory_lo + sizeof(from->memory);
+	size_t gfx_lo = offsetof(chip8_t, gfx), gfx_hi = gfx_lo + sizeof(from->gfx);
+	size_t first_lo = memory_lo < gfx_lo ? memory_lo : gfx_lo, first_hi = memory_lo < gfx_lo ? memory_hi : gfx_hi;
+	size_t second_lo = memory_lo < gfx_lo ? gfx_lo : memory_lo, second_hi = memory_lo < gfx_lo ? gfx_hi : memory_hi;
+	copy_bytes(to, from, 0, first_lo);
+	copy_bytes(to, from, first_hi, second_lo);
+	copy_bytes(to, from, second_hi, sizeof(chip8_t));
+}
+
+/* puts the machine back into the state of initial */
+static void reset(void){
+	size_t i;
+	unsigned short number;
+	unsigned long row;
+
+	for(i = 0; i < dirty_count; ++i){
+		number = dirty_pages[i];
+		memcpy(chip.memory + number * CHIP8_PAGE_SIZE, initial.memory + number * CHIP8_PAGE_SIZE,
+			number == CHIP8_PAGE_COUNT - 1 ? sizeof(chip.memory) - number * CHIP8_PAGE_SIZE : CHIP8_PAGE_SIZE);
+		page_dirty[number] = 0;
+	}
+	dirty_count = 0;
+	for(row = 0; dirty_rows != 0; ++row, dirty_rows >>= 1){
+		if(dirty_rows & 1)
+			memset(chip.gfx + row * CHIP_GFX_WIDTH, 0, CHIP_GFX_WIDTH);
+	}
+	copy_registers(&chip, &initial);
+}
+
+/* what the frontends do on a key event */
+static void press(unsigned char event){
+	unsigned char key = event & 0xF;
+	chip.keys[key] = (event & 0x80) != 0;
+	if((event & 0x80) && chip.waiting_keypress == 1){
+		chip.last_pressed = key;
+		chip.waiting_keypress = 2;
+	}
+}
+
+/* runs one input, returns the number of cycles */
+static long run(const unsigned char* data, size_t size){
+	const unsigned char* script = data + 1;
+	size_t events = 0, event = 0, rom;
+	unsigned long frame = 0, next_event = 0;
+	unsigned short opcode, pc;
+	unsigned char previous = 0, current;
+	long cycles = 0;
+
+	if(size > 0){
+		events = data[0];
+		if(events > (size - 1) / 2)
+			events = (size - 1) / 2;
+		data += 1 + 2 * events;
+		size -= 1 + 2 * events;
+	}
+	rom = size < MAX_ROM ? size : MAX_ROM;
+
+	reset();
+	chip8_load(&chip, (unsigned char*)data, rom);
+	if(rom > 0)
+		mark_pages(CHIP_PROGRAM_OFFSET, CHIP_PROGRAM_OFFSET + rom - 1);
+	if(events > 0)
+		next_event = script[0];
+	stopped = 0;
+
+	while(cycles < max_cycles && !stopped){
+		while(event < events && frame >= next_event){
+			press(script[2 * event + 1]);
+			if(++event < events)
+				next_event += script[2 * event];
+		}
+		if(chip.waiting_keypress == 1){
+			if(event == events)
+				break;
+			/* nothing runs until the key comes */
+			frame = next_event;
+			continue;
+		}
+
+		pc = chip.pc;
+		opcode = chip.memory[pc] << 8 | chip.memory[pc + 1];
+		current = handler_index[opcode];
+		++coverage[previous * MAX_HANDLERS + current];
+		previous = current;
+
+		chip8_cycle(&chip);
+		++cycles;
+		++frame;
+		/* jumped to itself, only a key can change anything now */
+		if((opcode & 0xF000) == 0x1000 && chip.pc == pc && event == events)
+			break;
+	}
+	return cycles;
+}
+
+#ifdef CHIP8_FUZZ_LIBFUZZER
+
+int LLVMFuzzerInitialize(int* argc, char*** argv){
+	setup();
+	return 0;
+}
+
+int LLVMFuzzerTestOneInput(const unsigned char* data, size_t size){
+	run(data, size);
+	return 0;
+}
+
+#else
+
+static unsigned char input[MAX_INPUT];
+
+/* reads a whole input, returns its length */
+static size_t read_input(FILE* file){
+	return fread(input, 1, sizeof(input), file);
+}
+
+static void report(const char* name, long cycles){
+	size_t i, covered = 0;
+	unsigned long runs[MAX_HANDLERS];
+
+	memset(runs, 0, sizeof(runs));
+	for(i = 0; i < MAX_HANDLERS * MAX_HANDLERS; ++i)
+		runs[i % MAX_HANDLERS] += coverage[i];
+	printf("%s: %ld cycles%s, handlers:", name, cycles, stopped ? ", unknown instruction" : "");
+	for(i = 0; i < handler_count; ++i){
+		if(runs[i] > 0){
+			printf(" %04hx", handler_opcode[i]);
+			++covered;
+		}
+	}
+	printf(" (%lu of %lu)\n", (unsigned long)covered, (unsigned long)handler_count);
+	memset(coverage, 0, sizeof(coverage));
+}
+
+int main(int argc, char** argv){
+	FILE* file;
+	size_t size;
+	int i;
+#ifdef __AFL_LOOP
+	ssize_t length;
+#endif
+
+	setup();
+#ifdef __AFL_LOOP
+	while(__AFL_LOOP(10000)){
+		length = read(0, input, sizeof(input));
+		run(input, length > 0 ? length : 0);
+	}
+	return 0;
+#endif
+	if(argc < 2){
+		size = read_input(stdin);
+		report("stdin", run(input, size));
+		return 0;
+	}
+	for(i = 1; i < argc; ++i){
+		file = fopen(argv[i], "rb");
+		if(file == NULL){
+			fprintf(stderr, "Can't open %s\n", argv[i]);
+			return 1;
+		}
+		size = read_input(file);
+		fclose(file);
+		report(argv[i], run(input, size));
+	}
+	return 0;
+}
+
+#endif
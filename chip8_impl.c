@@ -8,8 +8,9 @@ void chip8_clear_screen(chip8_t* chip, opcode_params_t* params){
 }
 
 void chip8_subroutine_return(chip8_t* chip, opcode_params_t* params){
-	/* set program counter to previous location */
-	chip->pc = chip->stack[chip->sp];
+	/* set program counter to previous location. sp wraps around the stack when
+	 * a program returns more often than it called (or calls too deep) */
+	chip->pc = chip->stack[chip->sp % CHIP_STACK_DEPTH];
 	/* decrement stack pointer */
 	--(chip->sp);
 }
@@ -23,7 +24,7 @@ void chip8_callsub(chip8_t* chip, opcode_params_t* params){
 	/* increment stack pointer */
 	++(chip->sp);
 	/* remember program counter value to stack */
-	chip->stack[chip->sp] = chip->pc;
+	chip->stack[chip->sp % CHIP_STACK_DEPTH] = chip->pc;
 	/* set program counter to nnn */
 	chip8_jump(chip, params);
 }
@@ -149,7 +150,7 @@ void chip8_jumpr(chip8_t* chip, opcode_params_t* params){
 
 void chip8_rand(chip8_t* chip, opcode_params_t* params){
 	/* set VX = random number & nn */
-	chip->V[params->x] = ((unsigned char)(rand() % 255)) & params->nn;
+	chip->V[params->x] = ((unsigned char)(chip8_random(chip) % 255)) & params->nn;
 }
 
 void chip8_draw(chip8_t* chip, opcode_params_t* params){
@@ -184,13 +185,14 @@ void chip8_draw(chip8_t* chip, opcode_params_t* params){
 }
 
 void chip8_skipkeydown(chip8_t* chip, opcode_params_t* params){
-	if(chip->keys[chip->V[params->x]] == 1){
+	/* there are only 16 keys, VX may hold anything */
+	if(chip->keys[chip->V[params->x] & 0xF] == 1){
 		chip->pc += 2;
 	}
 }
 
 void chip8_skipkeyup(chip8_t* chip, opcode_params_t* params){
-	if(chip->keys[chip->V[params->x]] == 0){
+	if(chip->keys[chip->V[params->x] & 0xF] == 0){
 		chip->pc += 2;
 	}
 }
@@ -0,0 +1,235 @@
+#include "chip8_profile.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* paths in the table when it's created, it doubles when it's half full */
+#define INITIAL_CAPACITY	256
+#define MAX_LABEL	64
+
+typedef struct {
+	/* return addresses, outermost first. the path is identified by them */
+	unsigned short returns[CHIP8_PROFILE_MAX_DEPTH];
+	/* subroutines they return from, read from memory when the path was first seen */
+	unsigned short targets[CHIP8_PROFILE_MAX_DEPTH];
+	unsigned short depth;
+	/* 0 - free slot */
+	unsigned long count;
+} path_t;
+
+struct chip8_profile {
+	unsigned long period;
+	/* cycles since the last sample and until the next one */
+	unsigned long elapsed, next;
+	/* generator of the intervals */
+	unsigned long random;
+	path_t* paths;
+	size_t capacity, used;
+	/* the path of the last sample, most samples hit it again */
+	path_t* last;
+	/* samples which didn't fit into memory */
+	unsigned long lost;
+	/* label of every address subroutines can start at, or NULL */
+	char* labels[CHIP_MEMORY_SIZE];
+};
+
+chip8_profile_t* chip8_profile_create(unsigned long period){
+	chip8_profile_t* profile = calloc(1, sizeof(chip8_profile_t));
+	if(profile == NULL)
+		return NULL;
+	profile->period = period > 0 ? period : 1;
+	profile->next = profile->period;
+	profile->random = 1;
+	profile->capacity = INITIAL_CAPACITY;
+	profile->paths = calloc(profile->capacity, sizeof(path_t));
+	if(profile->paths == NULL){
+		free(profile);
+		return NULL;
+	}
+	return profile;
+}
+
+int chip8_profile_load_labels(chip8_profile_t* profile, const char* path){
+	char line[256], name[MAX_LABEL];
+	unsigned long addr;
+	FILE* file = fopen(path, "r");
+
+	if(file == NULL)
+		return 0;
+	while(fgets(line, sizeof(line), file) != NULL){
+		if(line[0] == '#' || sscanf(line, "%lx %63s", &addr, name) != 2 || addr >= CHIP_MEMORY_SIZE)
+			continue;
+		free(profile->labels[addr]);
+		profile->labels[addr] = malloc(strlen(name) + 1);
+		if(profile->labels[addr] == NULL){
+			fclose(file);
+			return 0;
+		}
+		strcpy(profile->labels[addr], name);
+	}
+	fclose(file);
+	return 1;
+}
+
+static unsigned long hash(const unsigned short* returns, unsigned short depth){
+	unsigned long h = 2166136261UL;
+	unsigned short i;
+	for(i = 0; i < depth; ++i)
+		h = ((h ^ returns[i]) * 16777619UL) & 0xFFFFFFFFUL;
+	return h;
+}
+
+static path_t* find(path_t* paths, size_t capacity, const unsigned short* returns, unsigned short depth){
+	size_t i = hash(returns, depth) & (capacity - 1);
+	while(paths[i].count != 0 && (paths[i].depth != depth
+			|| memcmp(paths[i].returns, returns, depth * sizeof(unsigned short)) != 0))
+		i = (i + 1) & (capacity - 1);
+	return &paths[i];
+}
+
+/* doubles the table, returns 0 on failure */
+static int grow(chip8_profile_t* profile){
+	size_t capacity = profile->capacity * 2, i;
+	path_t* paths = calloc(capacity, sizeof(path_t));
+
+	if(paths == NULL)
+		return 0;
+	for(i = 0; i < profile->capacity; ++i){
+		if(profile->paths[i].count != 0)
+			*find(paths, capacity, profile->paths[i].returns, profile->paths[i].depth) = profile->paths[i];
+	}
+	free(profile->paths);
+	profile->paths = paths;
+	profile->capacity = capacity;
+	profile->last = NULL;
+	return 1;
+}
+
+/*
+ * cycles until the next sample. a fixed period would keep sampling the same
+ * instructions of a loop whose length it divides, so it's random with mean period
+ */
+static unsigned long interval(chip8_profile_t* profile){
+	if(profile->period == 1)
+		return 1;
+	profile->random = (profile->random * 1103515245UL + 12345) & 0xFFFFFFFFUL;
+	return 1 + (profile->random >> 8) % (2 * profile->period - 1);
+}
+
+/* subroutine which returns to addr - nnn of the 2nnn before it */
+static unsigned short call_target(const chip8_t* chip, unsigned short addr){
+	unsigned short opcode = chip->memory[(unsigned short)(addr - 2)] << 8 | chip->memory[(unsigned short)(addr - 1)];
+	/* memory changed since the call, name the call site instead */
+	if((opcode & 0xF000) != 0x2000)
+		return (addr - 2) & 0x0FFF;
+	return opcode & 0x0FFF;
+}
+
+void chip8_profile_add(chip8_profile_t* profile, const chip8_t* chip, unsigned long cycles){
+	unsigned short depth = chip->sp < CHIP8_PROFILE_MAX_DEPTH ? chip->sp : CHIP8_PROFILE_MAX_DEPTH, i;
+	const unsigned short* returns = chip->stack + 1;
+	unsigned long samples;
+	path_t* path;
+
+	profile->elapsed += cycles;
+	if(profile->elapsed < profile->next)
+		return;
+	for(samples = 0; profile->elapsed >= profile->next; ++samples){
+		profile->elapsed -= profile->next;
+		profile->next = interval(profile);
+	}
+
+	path = profile->last;
+	if(path == NULL || path->depth != depth || memcmp(path->returns, returns, depth * sizeof(unsigned short)) != 0){
+		path = find(profile->paths, profile->capacity, returns, depth);
+		if(path->count == 0){
+			if(2 * (profile->used + 1) > profile->capacity){
+				if(!grow(profile)){
+					profile->lost += samples;
+					return;
+				}
+				path = find(profile->paths, profile->capacity, returns, depth);
+			}
+			memcpy(path->returns, returns, depth * sizeof(unsigned short));
+			for(i = 0; i < depth; ++i)
+				path->targets[i] = call_target(chip, returns[i]);
+			path->depth = depth;
+			++profile->used;
+		}
+		profile->last = path;
+	}
+	path->count += samples;
+}
+
+/* orders paths by their subroutines, so that paths which only differ in call sites are next to each other */
+static int compare_targets(const void* a, const void* b){
+	const path_t* x = *(const path_t* const*)a;
+	const path_t* y = *(const path_t* const*)b;
+	unsigned short i;
+	for(i = 0; i < x->depth && i < y->depth; ++i){
+		if(x->targets[i] != y->targets[i])
+			return x->targets[i] < y->targets[i] ? -1 : 1;
+	}
+	return x->depth == y->depth ? 0 : x->depth < y->depth ? -1 : 1;
+}
+
+static void write_name(chip8_profile_t* profile, FILE* file, unsigned short addr){
+	if(profile->labels[addr] != NULL)
+		fputs(profile->labels[addr], file);
+	else
+		fprintf(file, "sub_%03hx", addr);
+}
+
+int chip8_profile_write(chip8_profile_t* profile, const char* path){
+	path_t** sorted;
+	size_t i, n = 0, same;
+	unsigned long count;
+	unsigned short j;
+	FILE* file;
+	int ok;
+
+	sorted = malloc((profile->used > 0 ? profile->used : 1) * sizeof(path_t*));
+	if(sorted == NULL)
+		return 0;
+	for(i = 0; i < profile->capacity; ++i){
+		if(profile->paths[i].count != 0)
+			sorted[n++] = &profile->paths[i];
+	}
+	qsort(sorted, n, sizeof(path_t*), compare_targets);
+
+	file = fopen(path, "w");
+	if(file == NULL){
+		free(sorted);
+		return 0;
+	}
+	for(i = 0; i < n; i += same){
+		/* one line for all call sites of the same subroutines */
+		count = 0;
+		for(same = 0; i + same < n && compare_targets(&sorted[i], &sorted[i + same]) == 0; ++same)
+			count += sorted[i + same]->count;
+		if(profile->labels[CHIP_PROGRAM_OFFSET] != NULL)
+			fputs(profile->labels[CHIP_PROGRAM_OFFSET], file);
+		else
+			fputs("main", file);
+		for(j = 0; j < sorted[i]->depth; ++j){
+			fputc(';', file);
+			write_name(profile, file, sorted[i]->targets[j]);
+		}
+		fprintf(file, " %lu\n", count);
+	}
+	if(profile->lost > 0)
+		fprintf(file, "[lost] %lu\n", profile->lost);
+	ok = ferror(file) == 0;
+	if(fclose(file) != 0)
+		ok = 0;
+	free(sorted);
+	return ok;
+}
+
+void chip8_profile_free(chip8_profile_t* profile){
+	size_t i;
+	for(i = 0; i < CHIP_MEMORY_SIZE; ++i)
+		free(profile->labels[i]);
+	free(profile->paths);
+	free(profile);
+}
@@ -0,0 +1,43 @@
+#ifndef __CHIP8_PROFILE_H__
+#define __CHIP8_PROFILE_H__
+
+#include "chip8.h"
+
+/*
+ * Call graph profiler for programs running in the machine.
+ *
+ * The call stack is read from chip->stack[1..sp] (see chip8_callsub): each entry
+ * is a return address, and the 2nnn instruction just before it names the
+ * subroutine which was called. Cycles are counted per call path, either all
+ * of them (period 1) or by samples taken every period cycles on average.
+ *
+ * The output is in the folded format which flame graph tools read, one path
+ * per line, callers first:
+ *	main;draw_board;sub_2f0 1234
+ * Subroutines are named by an optional label file, with lines like
+ *	0x2f0 draw_piece
+ * (# starts a comment). Subroutines without a label are sub_<address>, the
+ * program itself is main unless 0x200 has a label.
+ */
+
+/* call paths longer than this are cut (sp can't be more than this anyway, unless it wrapped) */
+#define CHIP8_PROFILE_MAX_DEPTH	(CHIP_STACK_DEPTH - 1)
+
+typedef struct chip8_profile chip8_profile_t;
+
+/* creates a profile which takes a sample every period cycles (on average), returns NULL on failure */
+chip8_profile_t* chip8_profile_create(unsigned long period);
+
+/* reads labels of subroutines, returns 0 on failure */
+int chip8_profile_load_labels(chip8_profile_t* profile, const char* path);
+
+/* counts cycles which the machine is about to run with its current call stack */
+void chip8_profile_add(chip8_profile_t* profile, const chip8_t* chip, unsigned long cycles);
+
+/* writes folded stacks, returns 0 on failure */
+int chip8_profile_write(chip8_profile_t* profile, const char* path);
+
+/* frees the profile */
+void chip8_profile_free(chip8_profile_t* profile);
+
+#endif
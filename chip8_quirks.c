@@ -0,0 +1,83 @@
+#include "chip8_quirks.h"
+#include "chip8_impl.h"
+#include <string.h>
+
+int chip8_quirks_by_name(const char* name){
+	static const char* names[CHIP8_QUIRKS_COUNT] = {"default", "vip", "schip", "modern"};
+	int i;
+	for(i = 0; i < CHIP8_QUIRKS_COUNT; ++i){
+		if(strcmp(name, names[i]) == 0)
+			return i;
+	}
+	return -1;
+}
+
+void chip8_orvxvy_vfreset(chip8_t* chip, opcode_params_t* params){
+	chip8_orvxvy(chip, params);
+	chip->V[0xF] = 0;
+}
+
+void chip8_andvxvy_vfreset(chip8_t* chip, opcode_params_t* params){
+	chip8_andvxvy(chip, params);
+	chip->V[0xF] = 0;
+}
+
+void chip8_xorvxvy_vfreset(chip8_t* chip, opcode_params_t* params){
+	chip8_xorvxvy(chip, params);
+	chip->V[0xF] = 0;
+}
+
+void chip8_shrvy(chip8_t* chip, opcode_params_t* params){
+	unsigned char carry = chip->V[params->y] & (1 << 0);
+	chip->V[params->x] = chip->V[params->y] >> 1;
+	chip->V[0xF] = carry;
+}
+
+void chip8_shlvy(chip8_t* chip, opcode_params_t* params){
+	unsigned char carry = (chip->V[params->y] & (1 << 7)) >> 7;
+	chip->V[params->x] = chip->V[params->y] << 1;
+	chip->V[0xF] = carry;
+}
+
+void chip8_jumpr_v0(chip8_t* chip, opcode_params_t* params){
+	chip->pc = params->nnn + chip->V[0];
+}
+
+void chip8_draw_clip(chip8_t* chip, opcode_params_t* params){
+	unsigned short vx = chip->V[params->x] % CHIP_GFX_WIDTH;
+	unsigned short vy = chip->V[params->y] % CHIP_GFX_HEIGHT;
+	unsigned short xOnSprite, yOnSprite;
+	unsigned short height = params->n;
+	unsigned char row, *pixel;
+
+	chip->V[0xF] = 0;
+	for(yOnSprite = 0; yOnSprite < height && vy + yOnSprite < CHIP_GFX_HEIGHT; ++yOnSprite){
+		row = chip->memory[chip->I + yOnSprite];
+		for(xOnSprite = 0; xOnSprite < 8 && vx + xOnSprite < CHIP_GFX_WIDTH; ++xOnSprite){
+			if(row & (0x80 >> xOnSprite)){
+				pixel = &chip->gfx[CHIP_GFX_WIDTH * (vy + yOnSprite) + vx + xOnSprite];
+				if(*pixel == 1)
+					chip->V[0xF] = 1;
+				*pixel ^= 1;
+			}
+		}
+	}
+}
+
+void chip8_writereg_keepi(chip8_t* chip, opcode_params_t* params){
+	memcpy(chip->memory + chip->I, chip->V, params->x + 1);
+}
+
+void chip8_loadreg_keepi(chip8_t* chip, opcode_params_t* params){
+	memcpy(chip->V, chip->memory + chip->I, params->x + 1);
+}
+
+void chip8_writereg_inci(chip8_t* chip, opcode_params_t* params){
+	chip8_writereg_keepi(chip, params);
+	chip->I += params->x + 1;
+}
+
+void chip8_loadreg_inci(chip8_t* chip, opcode_params_t* params){
+	chip8_loadreg_keepi(chip, params);
+	chip->I += params->x + 1;
+}
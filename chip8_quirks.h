@@ -0,0 +1,123 @@
+#ifndef __CHIP8_QUIRKS_H__
+#define __CHIP8_QUIRKS_H__
+#include "chip8.h"
+
+/*
+ * Quirk profiles - interpreters disagree on a few instructions. Every profile
+ * is a complete opcode table, in which these instructions are handled by the
+ * variants below, so there are no per-instruction checks.
+ *
+ *			shift	Fx55/Fx65	Bnnn	Dxyn	8xy1/2/3
+ *	DEFAULT		Vx	I unchanged	Vx	wrap	VF kept
+ *	VIP		Vy	I += x + 1	V0	clip	VF = 0
+ *	SCHIP		Vx	I unchanged	Vx	clip	VF kept
+ *	MODERN		Vx	I unchanged	V0	wrap	VF kept
+ *
+ * DEFAULT is how this interpreter always behaved, including Fx55/Fx65 which
+ * only transfer V0 through V(x-1). The other profiles transfer V0 through Vx.
+ */
+
+#define CHIP8_QUIRKS_DEFAULT	0
+#define CHIP8_QUIRKS_VIP	1
+#define CHIP8_QUIRKS_SCHIP	2
+#define CHIP8_QUIRKS_MODERN	3
+#define CHIP8_QUIRKS_COUNT	4
+
+/* returns profile with given name (default, vip, schip, modern) or -1 */
+int chip8_quirks_by_name(const char* name);
+
+/*
+
+8xy1 - OR Vx, Vy (VIP)
+	Set Vx = Vx OR Vy, set VF = 0.
+
+ */
+void chip8_orvxvy_vfreset(chip8_t* chip, opcode_params_t* params);
+
+/*
+
+8xy2 - AND Vx, Vy (VIP)
+	Set Vx = Vx AND Vy, set VF = 0.
+
+ */
+void chip8_andvxvy_vfreset(chip8_t* chip, opcode_params_t* params);
+
+/*
+
+8xy3 - XOR Vx, Vy (VIP)
+	Set Vx = Vx XOR Vy, set VF = 0.
+
+ */
+void chip8_xorvxvy_vfreset(chip8_t* chip, opcode_params_t* params);
+
+/*
+
+8xy6 - SHR Vx, Vy (VIP)
+	Set Vx = Vy SHR 1.
+
+	VF is set to the least-significant bit of Vy, after Vx was written.
+
+ */
+void chip8_shrvy(chip8_t* chip, opcode_params_t* params);
+
+/*
+
+8xyE - SHL Vx, Vy (VIP)
+	Set Vx = Vy SHL 1.
+
+	VF is set to the most-significant bit of Vy, after Vx was written.
+
+ */
+void chip8_shlvy(chip8_t* chip, opcode_params_t* params);
+
+/*
+
+Bnnn - JP V0, addr (VIP, MODERN)
+	Jump to location nnn + V0.
+
+ */
+void chip8_jumpr_v0(chip8_t* chip, opcode_params_t* params);
+
+/*
+
+Dxyn - DRW Vx, Vy, nibble (VIP, SCHIP)
+	Same as chip8_draw, but the sprite is clipped at the edges of the screen.
+
+	Only the starting position wraps around.
+
+ */
+void chip8_draw_clip(chip8_t* chip, opcode_params_t* params);
+
+/*
+
+Fx55 - LD [I], Vx (SCHIP, MODERN)
+	Store registers V0 through Vx in memory starting at location I. I is unchanged.
+
+ */
+void chip8_writereg_keepi(chip8_t* chip, opcode_params_t* params);
+
+/*
+
+Fx65 - LD Vx, [I] (SCHIP, MODERN)
+	Read registers V0 through Vx from memory starting at location I. I is unchanged.
+
+ */
+void chip8_loadreg_keepi(chip8_t* chip, opcode_params_t* params);
+
+/*
+
+Fx55 - LD [I], Vx (VIP)
+	Store registers V0 through Vx in memory starting at location I, then I = I + x + 1.
+
+ */
+void chip8_writereg_inci(chip8_t* chip, opcode_params_t* params);
+
+/*
+
+Fx65 - LD Vx, [I] (VIP)
+	Read registers V0 through Vx from memory starting at location I, then I = I + x + 1.
+
+ */
+void chip8_loadreg_inci(chip8_t* chip, opcode_params_t* params);
+
+#endif
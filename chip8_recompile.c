@@ -0,0 +1,508 @@
+/*
+ * chip8_recompile - translates a CHIP-8 ROM into a C translation unit.
+ *
+ * usage: chip8_recompile [-quirks <profile>] <rom> <output.c>
+ *
+ * Code is discovered by following the control flow from CHIP_PROGRAM_OFFSET
+ * (jumps, calls and their return sites, both paths of skips). Every discovered
+ * instruction becomes a case of one big switch on the program counter, direct
+ * jumps become gotos. Computed jumps (Bnnn) and returns go back through the
+ * switch, so anything which was not discovered is left to the interpreter.
+ * See chip8_compiled.h for the interface of the generated unit.
+ *
+ * Compile the output together with the core, e.g.:
+ *	cc -O2 -DCHIP8_COMPILED_MAIN rom.c chip8.o chip8_impl.o chip8_cpu.o chip8_quirks.o
+ * CHIP8_COMPILED_MAIN adds a headless main which runs the ROM for given amount of cycles.
+ *
+ * The quirk profile (see chip8_quirks.h) is baked into the generated code, the
+ * interpreter has to use the same one (chip8_compiled_quirks).
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "chip8.h"
+#include "chip8_quirks.h"
+
+/* instruction at this address was decoded */
+#define ADDR_DECODED	1
+/* something jumps or skips to this address */
+#define ADDR_TARGET	2
+/* this address is a target of 2nnn */
+#define ADDR_SUB	4
+
+/* ROM image - fonts are not needed for translation, but are part of the image */
+static unsigned char image[CHIP_MEMORY_SIZE];
+/* ADDR_* flags for every address */
+static unsigned char flags[CHIP_MEMORY_SIZE];
+/* 1 if a byte is part of a decoded instruction */
+static unsigned char code_map[CHIP_MEMORY_SIZE];
+/* addresses waiting to be decoded */
+static unsigned short worklist[CHIP_MEMORY_SIZE];
+static size_t worklist_length = 0;
+/* CHIP8_QUIRKS_* profile of the generated code */
+static int quirks = CHIP8_QUIRKS_DEFAULT;
+
+extern unsigned char chip8_fontset[80];
+
+static unsigned short fetch(unsigned short addr){
+	return (image[addr] << 8) | image[addr + 1];
+}
+
+/* 1 if the opcode has a handler in the opcode table (see chip8_impl.h) */
+static int is_known(unsigned short op){
+	switch(op & 0xF000){
+	case 0x0000:
+		return op == 0x00E0 || op == 0x00EE;
+	case 0x5000:
+	case 0x9000:
+		return (op & 0x000F) == 0;
+	case 0x8000:
+		return (op & 0x000F) <= 7 || (op & 0x000F) == 0xE;
+	case 0xE000:
+		return (op & 0x00FF) == 0x9E || (op & 0x00FF) == 0xA1;
+	case 0xF000:
+		switch(op & 0x00FF){
+		case 0x07: case 0x0A: case 0x15: case 0x18: case 0x1E:
+		case 0x29: case 0x33: case 0x55: case 0x65:
+			return 1;
+		}
+		return 0;
+	}
+	return 1;
+}
+
+/* 1 if an instruction can be decoded at the address */
+static int is_decodable(unsigned short addr){
+	return addr + 1 < CHIP_MEMORY_SIZE && is_known(fetch(addr));
+}
+
+static void add_address(unsigned short addr, unsigned char flag){
+	if(addr + 1 >= CHIP_MEMORY_SIZE)
+		return;
+	flags[addr] |= flag;
+	if(!(flags[addr] & ADDR_DECODED) && is_decodable(addr)){
+		flags[addr] |= ADDR_DECODED;
+		worklist[worklist_length++] = addr;
+	}
+}
+
+/* recovers control flow graph starting at the program offset */
+static void discover(void){
+	add_address(CHIP_PROGRAM_OFFSET, 0);
+	while(worklist_length > 0){
+		unsigned short addr = worklist[--worklist_length];
+		unsigned short op = fetch(addr);
+		code_map[addr] = code_map[addr + 1] = 1;
+		switch(op & 0xF000){
+		case 0x0000:
+			/* 00EE continues wherever the stack says */
+			if(op == 0x00E0)
+				add_address(addr + 2, 0);
+			break;
+		case 0x1000:
+			add_address(op & 0x0FFF, ADDR_TARGET);
+			break;
+		case 0x2000:
+			add_address(op & 0x0FFF, ADDR_TARGET | ADDR_SUB);
+			/* the return site is entered through the dispatch switch */
+			add_address(addr + 2, 0);
+			break;
+		case 0x3000: case 0x4000: case 0x5000: case 0x9000: case 0xE000:
+			add_address(addr + 2, 0);
+			add_address(addr + 4, ADDR_TARGET);
+			break;
+		case 0xB000:
+			/* computed jump, continues through the dispatch switch */
+			break;
+		default:
+			/* Fx0A stops translated code, but the interpreter resumes after it */
+			add_address(addr + 2, 0);
+			break;
+		}
+	}
+}
+
+/* 1 if execution may continue at the following instruction */
+static int falls_through(unsigned short op){
+	switch(op & 0xF000){
+	case 0x0000:
+		return op == 0x00E0;
+	case 0x1000:
+	case 0x2000:
+	case 0xB000:
+		return 0;
+	case 0xF000:
+		return (op & 0x00FF) != 0x0A;
+	}
+	return 1;
+}
+
+/* falling through to an instruction which is not emitted right after needs a label */
+static void mark_fallthrough_targets(void){
+	unsigned addr;
+	int previous = -1;
+	for(addr = 0; addr < CHIP_MEMORY_SIZE; ++addr){
+		if(!(flags[addr] & ADDR_DECODED))
+			continue;
+		if(previous >= 0 && falls_through(fetch(previous)) && previous + 2 != addr)
+			add_address(previous + 2, ADDR_TARGET);
+		previous = addr;
+	}
+	if(previous >= 0 && falls_through(fetch(previous)))
+		add_address(previous + 2, ADDR_TARGET);
+}
+
+/* emits a transfer of control to the address */
+static void emit_goto(FILE* out, unsigned short target){
+	if(target + 1 < CHIP_MEMORY_SIZE && (flags[target] & ADDR_DECODED)){
+		fprintf(out, "\t\tgoto L_%03x;\n", target);
+	} else {
+		fprintf(out, "\t\tchip->pc = 0x%03x;\n\t\treturn cycles;\n", target);
+	}
+}
+
+/* emits a conditional skip of the next instruction */
+static void emit_skip(FILE* out, const char* condition, unsigned short addr){
+	fprintf(out, "\t\tTICK();\n\t\tif(%s)\n\t", condition);
+	if(addr + 5 < CHIP_MEMORY_SIZE && (flags[addr + 4] & ADDR_DECODED)){
+		fprintf(out, "\tgoto L_%03x;\n", addr + 4);
+	} else {
+		fprintf(out, "\t{ chip->pc = 0x%03x; return cycles; }\n", addr + 4);
+	}
+}
+
+/* emits opcode_params_t for handlers which are called directly */
+static void emit_params(FILE* out, unsigned short op){
+	fprintf(out, "\t\tp.nnn = 0x%03x; p.nn = 0x%02x; p.n = 0x%x; p.x = 0x%x; p.y = 0x%x;\n",
+		op & 0x0FFF, op & 0x00FF, op & 0x000F, (op & 0x0F00) >> 8, (op & 0x00F0) >> 4);
+}
+
+/* emits a store which may overwrite translated code */
+static void emit_store(FILE* out, unsigned short op, unsigned short addr, const char* handler, unsigned length){
+	emit_params(out, op);
+	fprintf(out, "\t\tlo = chip->I;\n\t\t%s(chip, &p);\n\t\tTICK();\n", handler);
+	fprintf(out, "\t\tif(code_modified(chip, lo, lo + %u)){ *stale = 1; chip->pc = 0x%03x; return cycles; }\n", length, addr + 2);
+}
+
+/* Fx55/Fx65 handler of the profile */
+static const char* reg_handler(const char* name){
+	static char handler[64];
+	const char* suffix = "";
+	if(quirks == CHIP8_QUIRKS_VIP)
+		suffix = "_inci";
+	else if(quirks != CHIP8_QUIRKS_DEFAULT)
+		suffix = "_keepi";
+	sprintf(handler, "%s%s", name, suffix);
+	return handler;
+}
+
+/* emits one instruction */
+static void emit_instruction(FILE* out, unsigned short addr){
+	unsigned short op = fetch(addr);
+	unsigned x = (op & 0x0F00) >> 8, y = (op & 0x00F0) >> 4;
+	unsigned nnn = op & 0x0FFF, nn = op & 0x00FF;
+	char condition[64];
+
+	fprintf(out, "\tcase 0x%03x:", addr);
+	if(flags[addr] & ADDR_TARGET)
+		fprintf(out, " L_%03x:", addr);
+	/* every path into an instruction comes through here, so the budget is exact */
+	fprintf(out, " /* %04x */\n\t\tif(cycles >= budget){ chip->pc = 0x%03x; return cycles; }\n\t\tcycles++;\n", op, addr);
+
+	switch(op & 0xF000){
+	case 0x0000:
+		if(op == 0x00E0){
+			fprintf(out, "\t\tmemset(chip->gfx, 0, sizeof(chip->gfx));\n");
+			break;
+		}
+		fprintf(out, "\t\tchip->pc = chip->stack[chip->sp %% CHIP_STACK_DEPTH];\n\t\t--(chip->sp);\n\t\tTICK();\n\t\tgoto dispatch;\n");
+		return;
+	case 0x1000:
+		fprintf(out, "\t\tTICK();\n");
+		emit_goto(out, nnn);
+		return;
+	case 0x2000:
+		fprintf(out, "\t\t++(chip->sp);\n\t\tchip->stack[chip->sp %% CHIP_STACK_DEPTH] = 0x%03x;\n\t\tTICK();\n", addr + 2);
+		emit_goto(out, nnn);
+		return;
+	case 0x3000:
+		sprintf(condition, "chip->V[0x%x] == 0x%02x", x, nn);
+		emit_skip(out, condition, addr);
+		return;
+	case 0x4000:
+		sprintf(condition, "chip->V[0x%x] != 0x%02x", x, nn);
+		emit_skip(out, condition, addr);
+		return;
+	case 0x5000:
+		sprintf(condition, "chip->V[0x%x] == chip->V[0x%x]", x, y);
+		emit_skip(out, condition, addr);
+		return;
+	case 0x6000:
+		fprintf(out, "\t\tchip->V[0x%x] = 0x%02x;\n", x, nn);
+		break;
+	case 0x7000:
+		fprintf(out, "\t\tchip->V[0x%x] += 0x%02x;\n", x, nn);
+		break;
+	case 0x8000:
+		switch(op & 0x000F){
+		case 0x0:
+			fprintf(out, "\t\tchip->V[0x%x] = chip->V[0x%x];\n", x, y);
+			break;
+		case 0x1:
+			fprintf(out, "\t\tchip->V[0x%x] |= chip->V[0x%x];\n", x, y);
+			if(quirks == CHIP8_QUIRKS_VIP)
+				fprintf(out, "\t\tchip->V[0xF] = 0;\n");
+			break;
+		case 0x2:
+			fprintf(out, "\t\tchip->V[0x%x] &= chip->V[0x%x];\n", x, y);
+			if(quirks == CHIP8_QUIRKS_VIP)
+				fprintf(out, "\t\tchip->V[0xF] = 0;\n");
+			break;
+		case 0x3:
+			fprintf(out, "\t\tchip->V[0x%x] ^= chip->V[0x%x];\n", x, y);
+			if(quirks == CHIP8_QUIRKS_VIP)
+				fprintf(out, "\t\tchip->V[0xF] = 0;\n");
+			break;
+		case 0x4:
+			fprintf(out, "\t\tchip->V[0xF] = chip->V[0x%x] + chip->V[0x%x] > 255;\n", x, y);
+			fprintf(out, "\t\tchip->V[0x%x] += chip->V[0x%x];\n", x, y);
+			break;
+		case 0x5:
+			fprintf(out, "\t\tchip->V[0xF] = chip->V[0x%x] > chip->V[0x%x];\n", x, y);
+			fprintf(out, "\t\tchip->V[0x%x] -= chip->V[0x%x];\n", x, y);
+			break;
+		case 0x6:
+			if(quirks == CHIP8_QUIRKS_VIP){
+				fprintf(out, "\t\tcarry = chip->V[0x%x] & 0x01;\n", y);
+				fprintf(out, "\t\tchip->V[0x%x] = chip->V[0x%x] >> 1;\n", x, y);
+				fprintf(out, "\t\tchip->V[0xF] = carry;\n");
+				break;
+			}
+			fprintf(out, "\t\tchip->V[0xF] = chip->V[0x%x] & 0x01;\n", x);
+			fprintf(out, "\t\tchip->V[0x%x] = chip->V[0x%x] >> 1;\n", x, x);
+			break;
+		case 0x7:
+			fprintf(out, "\t\tchip->V[0xF] = chip->V[0x%x] < chip->V[0x%x];\n", x, y);
+			fprintf(out, "\t\tchip->V[0x%x] = chip->V[0x%x] - chip->V[0x%x];\n", x, y, x);
+			break;
+		case 0xE:
+			if(quirks == CHIP8_QUIRKS_VIP){
+				fprintf(out, "\t\tcarry = (chip->V[0x%x] & 0x80) != 0;\n", y);
+				fprintf(out, "\t\tchip->V[0x%x] = chip->V[0x%x] << 1;\n", x, y);
+				fprintf(out, "\t\tchip->V[0xF] = carry;\n");
+				break;
+			}
+			fprintf(out, "\t\tchip->V[0xF] = (chip->V[0x%x] & 0x80) != 0;\n", x);
+			fprintf(out, "\t\tchip->V[0x%x] = chip->V[0x%x] << 1;\n", x, x);
+			break;
+		}
+		break;
+	case 0x9000:
+		sprintf(condition, "chip->V[0x%x] != chip->V[0x%x]", x, y);
+		emit_skip(out, condition, addr);
+		return;
+	case 0xA000:
+		fprintf(out, "\t\tchip->I = 0x%03x;\n", nnn);
+		break;
+	case 0xB000:
+		/* Bnnn adds V0 or Vx depending on the profile */
+		if(quirks == CHIP8_QUIRKS_VIP || quirks == CHIP8_QUIRKS_MODERN)
+			x = 0;
+		fprintf(out, "\t\tchip->pc = 0x%03x + chip->V[0x%x];\n\t\tTICK();\n\t\tgoto dispatch;\n", nnn, x);
+		return;
+	case 0xC000:
+		fprintf(out, "\t\tchip->V[0x%x] = ((unsigned char)(chip8_random(chip) %% 255)) & 0x%02x;\n", x, nn);
+		break;
+	case 0xD000:
+		emit_params(out, op);
+		fprintf(out, "\t\t%s(chip, &p);\n",
+			quirks == CHIP8_QUIRKS_VIP || quirks == CHIP8_QUIRKS_SCHIP ? "chip8_draw_clip" : "chip8_draw");
+		break;
+	case 0xE000:
+		sprintf(condition, "chip->keys[chip->V[0x%x] & 0xF] == %d", x, nn == 0x9E ? 1 : 0);
+		emit_skip(out, condition, addr);
+		return;
+	case 0xF000:
+		switch(nn){
+		case 0x07:
+			fprintf(out, "\t\tchip->V[0x%x] = chip->delay_timer;\n", x);
+			break;
+		case 0x0A:
+			/* the interpreter finishes the instruction once a key is pressed */
+			fprintf(out, "\t\tchip->opcode = 0x%04x;\n\t\tchip->waiting_keypress = 1;\n", op);
+			fprintf(out, "\t\tchip->pc = 0x%03x;\n\t\tTICK();\n\t\treturn cycles;\n", addr + 2);
+			return;
+		case 0x15:
+			fprintf(out, "\t\tchip->delay_timer = chip->V[0x%x];\n", x);
+			break;
+		case 0x18:
+			fprintf(out, "\t\tchip->sound_timer = chip->V[0x%x];\n", x);
+			break;
+		case 0x1E:
+			fprintf(out, "\t\tchip->I += chip->V[0x%x];\n", x);
+			break;
+		case 0x29:
+			fprintf(out, "\t\tchip->I = CHIP_FONTS_OFFSET + 5 * chip->V[0x%x];\n", x);
+			break;
+		case 0x33:
+			emit_store(out, op, addr, "chip8_bcdvx", 2);
+			return;
+		case 0x55:
+			emit_store(out, op, addr, reg_handler("chip8_writereg"), x);
+			return;
+		case 0x65:
+			emit_params(out, op);
+			fprintf(out, "\t\t%s(chip, &p);\n", reg_handler("chip8_loadreg"));
+			break;
+		}
+		break;
+	}
+	fprintf(out, "\t\tTICK();\n");
+}
+
+static void emit(FILE* out, const char* rom_name){
+	unsigned addr;
+	int previous = -1;
+
+	fprintf(out, "/* generated by chip8_recompile from %s - do not edit */\n", rom_name);
+	fprintf(out, "#include <stdio.h>\n#include <stdlib.h>\n#include <string.h>\n");
+	fprintf(out, "#include \"chip8.h\"\n#include \"chip8_impl.h\"\n#include \"chip8_quirks.h\"\n");
+	fprintf(out, "#include \"chip8_cpu.h\"\n#include \"chip8_compiled.h\"\n\n");
+	fprintf(out, "const int chip8_compiled_quirks = %d;\n\n", quirks);
+	fprintf(out, "/* same as chip8_update_timers, which is only called if someone wants the frames */\n");
+	fprintf(out, "#define TICK() do { \\\n"
+		"\tif(frames) { chip8_update_timers(chip); break; } \\\n"
+		"\tif(chip->delay_timer > 0) chip->delay_timer -= 1; \\\n"
+		"\tif(chip->sound_timer > 0) chip->sound_timer -= 1; \\\n"
+		"} while(0)\n\n");
+
+	fprintf(out, "const unsigned char chip8_compiled_image[CHIP_MEMORY_SIZE] = {");
+	for(addr = 0; addr < CHIP_MEMORY_SIZE; ++addr)
+		fprintf(out, "%s0x%02x,", addr % 16 == 0 ? "\n\t" : "", image[addr]);
+	fprintf(out, "\n};\n\n");
+
+	fprintf(out, "/* 1 if a byte belongs to translated code */\nstatic const unsigned char code_map[CHIP_MEMORY_SIZE] = {");
+	for(addr = 0; addr < CHIP_MEMORY_SIZE; ++addr)
+		fprintf(out, "%s%d,", addr % 32 == 0 ? "\n\t" : "", code_map[addr]);
+	fprintf(out, "\n};\n\n");
+
+	fprintf(out,
+		"int chip8_compiled_valid(chip8_t* chip){\n"
+		"\tunsigned addr;\n"
+		"\tfor(addr = 0; addr < CHIP_MEMORY_SIZE; ++addr){\n"
+		"\t\tif(code_map[addr] && chip->memory[addr] != chip8_compiled_image[addr])\n"
+		"\t\t\treturn 0;\n"
+		"\t}\n"
+		"\treturn 1;\n"
+		"}\n\n"
+		"/* 1 if a store to [lo, hi] has changed translated code */\n"
+		"static int code_modified(chip8_t* chip, unsigned lo, unsigned hi){\n"
+		"\tfor(; lo <= hi && lo < CHIP_MEMORY_SIZE; ++lo){\n"
+		"\t\tif(code_map[lo] && chip->memory[lo] != chip8_compiled_image[lo])\n"
+		"\t\t\treturn 1;\n"
+		"\t}\n"
+		"\treturn 0;\n"
+		"}\n\n");
+
+	fprintf(out,
+		"long chip8_compiled_run(chip8_t* chip, long budget, int* stale){\n"
+		"\tlong cycles = 0;\n"
+		"\topcode_params_t p;\n"
+		"\tunsigned short lo;\n"
+		"\tunsigned char carry;\n"
+		"\tint frames = chip8_get_frame_callback() != NULL;\n"
+		"\t/* the interpreter ran the last instruction, its stores aren't checked anywhere else */\n"
+		"\tif(((chip->opcode & 0xF0FF) == 0xF033 || (chip->opcode & 0xF0FF) == 0xF055)\n"
+		"\t\t\t&& code_modified(chip, chip->I >= CHIP_ADDRESS_GUARD ? chip->I - CHIP_ADDRESS_GUARD : 0,\n"
+		"\t\t\t\tchip->I + CHIP_ADDRESS_GUARD - 1)){\n"
+		"\t\t*stale = 1;\n"
+		"\t\treturn 0;\n"
+		"\t}\n"
+		"\tif(chip->waiting_keypress != 0)\n"
+		"\t\treturn 0;\n"
+		"dispatch:\n"
+		"\tswitch(chip->pc){\n");
+	for(addr = 0; addr < CHIP_MEMORY_SIZE; ++addr){
+		if(!(flags[addr] & ADDR_DECODED))
+			continue;
+		/* the previous instruction falls through, but not into this one */
+		if(previous >= 0 && falls_through(fetch(previous)) && previous + 2 != addr)
+			emit_goto(out, previous + 2);
+		if(flags[addr] & ADDR_SUB)
+			fprintf(out, "\t/* sub_%03x */\n", addr);
+		emit_instruction(out, addr);
+		previous = addr;
+	}
+	if(previous >= 0 && falls_through(fetch(previous)))
+		emit_goto(out, previous + 2);
+	fprintf(out,
+		"\tdefault:\n"
+		"\t\treturn cycles;\n"
+		"\t}\n"
+		"\t(void)p; (void)lo; (void)carry; (void)stale; (void)code_modified;\n"
+		"\treturn cycles;\n"
+		"}\n\n");
+
+	fprintf(out,
+		"#ifdef CHIP8_COMPILED_MAIN\n"
+		"static chip8_t chip;\n\n"
+		"int main(int argc, char** argv){\n"
+		"\tlong cycles = argc > 1 ? atol(argv[1]) : 1000000, done = 0;\n"
+		"\tunsigned long hash = 5381;\n"
+		"\tint stale, i;\n"
+		"\tchip8_select_quirks(chip8_compiled_quirks);\n"
+		"\tchip8_init(&chip);\n"
+		"\tmemcpy(chip.memory, chip8_compiled_image, sizeof(chip8_compiled_image));\n"
+		"\tstale = !chip8_compiled_valid(&chip);\n"
+		"\twhile(done < cycles && chip.waiting_keypress != 1){\n"
+		"\t\tlong n = stale ? 0 : chip8_compiled_run(&chip, cycles - done, &stale);\n"
+		"\t\tif(n == 0){\n"
+		"\t\t\tchip8_cycle(&chip);\n"
+		"\t\t\tn = 1;\n"
+		"\t\t}\n"
+		"\t\tdone += n;\n"
+		"\t}\n"
+		"\tfor(i = 0; i < CHIP_GFX_WIDTH * CHIP_GFX_HEIGHT; ++i)\n"
+		"\t\thash = hash * 33 + chip.gfx[i];\n"
+		"\tprintf(\"cycles %%ld pc %%03x I %%03x gfx %%08lx\\n\", done, chip.pc, chip.I, hash & 0xFFFFFFFF);\n"
+		"\treturn 0;\n"
+		"}\n"
+		"#endif\n");
+}
+
+int main(int argc, char** argv){
+	FILE* file;
+	size_t length;
+	int arg = 1;
+
+	if(argc > 2 && strcmp(argv[1], "-quirks") == 0){
+		quirks = chip8_quirks_by_name(argv[2]);
+		arg = 3;
+	}
+	if(argc - arg < 2 || quirks < 0){
+		fprintf(stderr, "usage: %s [-quirks default|vip|schip|modern] <rom> <output.c>\n", argv[0]);
+		return 1;
+	}
+	file = fopen(argv[arg], "rb");
+	if(file == NULL){
+		fprintf(stderr, "Error: Unable to open %s\n", argv[arg]);
+		return 1;
+	}
+	memcpy(image + CHIP_FONTS_OFFSET, chip8_fontset, sizeof(chip8_fontset));
+	length = fread(image + CHIP_PROGRAM_OFFSET, 1, CHIP_MEMORY_SIZE - CHIP_PROGRAM_OFFSET, file);
+	fclose(file);
+
+	discover();
+	mark_fallthrough_targets();
+
+	file = fopen(argv[arg + 1], "w");
+	if(file == NULL){
+		fprintf(stderr, "Error: Unable to open %s\n", argv[arg + 1]);
+		return 1;
+	}
+	emit(file, argv[arg]);
+	fclose(file);
+	fprintf(stderr, "translated %lu bytes of %s\n", (unsigned long)length, argv[arg]);
+	return 0;
+}
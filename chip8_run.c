@@ -0,0 +1,264 @@
+/*
+ * chip8_run - runs a ROM without a display.
+ *
+ * usage: chip8_run [options] <rom>
+ *	-frames <n>		number of frames to run (default 600 - 10 seconds)
+ *	-record <file>		record the screen (see chip8_capture.h)
+ *	-format <y4m|raw|png>	format of the recording (default y4m)
+ *	-quirks <profile>	default, vip, schip or modern (see chip8_quirks.h)
+ *	-shm <name>		publish frames into shared memory (see chip8_shm.h) and run
+ *				in real time, 0 frames means until interrupted
+ *	-fuse			run common instruction sequences as superinstructions (see chip8_fuse.h)
+ *	-verify			-fuse and check it against running one instruction at a time,
+ *				key waits get keys 0, 1, 2, ... so that the code after them is checked too
+ *	-profile <file>		write cycles per call path as folded stacks (see chip8_profile.h)
+ *	-labels <file>		names of subroutines for -profile
+ *	-sample <n>		-profile takes a sample every n cycles (default 1 - counts every cycle)
+ */
+#define _POSIX_C_SOURCE 200112L
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "chip8.h"
+#include "chip8_capture.h"
+#include "chip8_cpu.h"
+#include "chip8_fuse.h"
+#include "chip8_profile.h"
+#include "chip8_quirks.h"
+#include "chip8_shm.h"
+
+/* length of a frame in nanoseconds (60 Hz) */
+#define FRAME_NS	(1000000000L / 60)
+
+static chip8_t chip;
+/* the same machine run one instruction at a time (-verify) */
+static chip8_t reference;
+/* set by SIGINT/SIGTERM */
+static volatile sig_atomic_t interrupted = 0;
+
+static void on_signal(int signal){
+	interrupted = 1;
+}
+
+/* sleeps until the next frame starts */
+static void wait_frame(struct timespec* next){
+	next->tv_nsec += FRAME_NS;
+	if(next->tv_nsec >= 1000000000L){
+		next->tv_nsec -= 1000000000L;
+		next->tv_sec += 1;
+	}
+	clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, next, NULL);
+}
+
+/* finishes Fx0A the way the frontends do */
+static void press(chip8_t* chip, unsigned char key){
+	chip->last_pressed = key;
+	chip->waiting_keypress = 2;
+}
+
+/* loads program from file, returns 0 on failure */
+static size_t load_program(const char* filename, unsigned char* whereToLoad, size_t max_length){
+	size_t result;
+	FILE* file = fopen(filename, "rb");
+	if(file == NULL)
+		return 0;
+	result = fread(whereToLoad, sizeof(char), max_length, file);
+	fclose(file);
+	return result;
+}
+
+static int parse_format(const char* name){
+	if(strcmp(name, "y4m") == 0)
+		return CHIP8_CAPTURE_Y4M;
+	if(strcmp(name, "raw") == 0)
+		return CHIP8_CAPTURE_RAW;
+	if(strcmp(name, "png") == 0)
+		return CHIP8_CAPTURE_PNG;
+	return -1;
+}
+
+static void usage(const char* name){
+	fprintf(stderr, "usage: %s [-frames n] [-record file] [-format y4m|raw|png] [-quirks profile] [-shm name] [-fuse] [-verify]\n\t[-profile file] [-labels file] [-sample n] <rom>\n", name);
+}
+
+int main(int argc, char** argv){
+	unsigned char program[CHIP_MEMORY_SIZE - CHIP_PROGRAM_OFFSET];
+	size_t program_length;
+	unsigned long frames = 600, frame, ran, presses = 0;
+	const char* rom = NULL;
+	const char* record = NULL;
+	const char* shm_name = NULL;
+	const char* profile_path = NULL;
+	const char* labels = NULL;
+	unsigned long period = 1;
+	chip8_profile_t* profile = NULL;
+	int format = CHIP8_CAPTURE_Y4M;
+	chip8_capture_t* capture = NULL;
+	chip8_capture_stats_t stats;
+	chip8_shm_t* shm = NULL;
+	struct timespec next;
+	chip8_fuse_t* fuse = NULL;
+	chip8_frame_callback_t callback;
+	int verify = 0, fused = 0;
+	int i;
+
+	for(i = 1; i < argc; ++i){
+		if(strcmp(argv[i], "-frames") == 0 && i + 1 < argc){
+			frames = strtoul(argv[++i], NULL, 10);
+		} else if(strcmp(argv[i], "-record") == 0 && i + 1 < argc){
+			record = argv[++i];
+		} else if(strcmp(argv[i], "-format") == 0 && i + 1 < argc){
+			format = parse_format(argv[++i]);
+			if(format < 0){
+				usage(argv[0]);
+				return 1;
+			}
+		} else if(strcmp(argv[i], "-quirks") == 0 && i + 1 < argc){
+			if(!chip8_select_quirks(chip8_quirks_by_name(argv[++i]))){
+				usage(argv[0]);
+				return 1;
+			}
+		} else if(strcmp(argv[i], "-shm") == 0 && i + 1 < argc){
+			shm_name = argv[++i];
+		} else if(strcmp(argv[i], "-fuse") == 0){
+			fused = 1;
+		} else if(strcmp(argv[i], "-verify") == 0){
+			fused = verify = 1;
+		} else if(strcmp(argv[i], "-profile") == 0 && i + 1 < argc){
+			profile_path = argv[++i];
+		} else if(strcmp(argv[i], "-labels") == 0 && i + 1 < argc){
+			labels = argv[++i];
+		} else if(strcmp(argv[i], "-sample") == 0 && i + 1 < argc){
+			period = strtoul(argv[++i], NULL, 10);
+		} else if(argv[i][0] != '-' && rom == NULL){
+			rom = argv[i];
+		} else {
+			usage(argv[0]);
+			return 1;
+		}
+	}
+	if(rom == NULL){
+		usage(argv[0]);
+		return 1;
+	}
+	if(profile_path != NULL && fused){
+		/* superinstructions run many cycles at once, calls included */
+		fprintf(stderr, "Error: -profile can't be used with -fuse\n");
+		return 1;
+	}
+	program_length = load_program(rom, program, sizeof(program));
+	if(program_length == 0){
+		fprintf(stderr, "Error: Unable to load %s\n", rom);
+		return 1;
+	}
+
+	chip8_init(&chip);
+	chip8_load(&chip, program, program_length);
+	reference = chip;
+	if(fused){
+		fuse = malloc(sizeof(chip8_fuse_t));
+		if(fuse == NULL){
+			fprintf(stderr, "Error: Out of memory\n");
+			return 1;
+		}
+		chip8_fuse_reset(fuse);
+	}
+	if(profile_path != NULL){
+		profile = chip8_profile_create(period);
+		if(profile == NULL){
+			fprintf(stderr, "Error: Out of memory\n");
+			return 1;
+		}
+		if(labels != NULL && !chip8_profile_load_labels(profile, labels)){
+			fprintf(stderr, "Error: Unable to load labels from %s\n", labels);
+			return 1;
+		}
+	}
+	if(record != NULL){
+		capture = chip8_capture_open(record, format, CHIP8_CAPTURE_QUEUE_LENGTH);
+		if(capture == NULL){
+			fprintf(stderr, "Error: Unable to record to %s\n", record);
+			return 1;
+		}
+		chip8_set_frame_callback(chip8_capture_frame, capture);
+	}
+	if(shm_name != NULL){
+		shm = chip8_shm_create(shm_name);
+		if(shm == NULL){
+			fprintf(stderr, "Error: Unable to create shared memory %s\n", shm_name);
+			return 1;
+		}
+		signal(SIGINT, on_signal);
+		signal(SIGTERM, on_signal);
+		clock_gettime(CLOCK_MONOTONIC, &next);
+	}
+
+	/* one cycle per frame, same as chipm8 */
+	for(frame = 0; (frames == 0 && shm != NULL) || frame < frames; frame += ran){
+		if(interrupted)
+			break;
+		if(shm != NULL){
+			chip8_shm_apply_keys(shm, &chip);
+			if(verify)
+				chip8_shm_apply_keys(shm, &reference);
+		} else if(chip.waiting_keypress == 1){
+			/* there's nobody to press a key */
+			if(!verify)
+				break;
+			press(&chip, presses % CHIP_KEYS_COUNT);
+			press(&reference, presses % CHIP_KEYS_COUNT);
+			++presses;
+		}
+		if(fuse != NULL){
+			/* in real time every frame is published, there's no room for sequences */
+			ran = chip8_fuse_run(&chip, fuse, shm != NULL ? 1 : frames - frame);
+		} else {
+			if(profile != NULL)
+				chip8_profile_add(profile, &chip, 1);
+			chip8_cycle(&chip);
+			ran = 1;
+		}
+		if(verify){
+			/* the recording only gets frames of the machine which is verified */
+			callback = chip8_get_frame_callback();
+			chip8_set_frame_callback(NULL, NULL);
+			for(i = 0; i < ran; ++i)
+				chip8_cycle(&reference);
+			chip8_set_frame_callback(callback, capture);
+			if(memcmp(&chip, &reference, sizeof(chip8_t)) != 0){
+				fprintf(stderr, "Error: superinstructions went wrong in frames %lu - %lu (pc %03hx, should be %03hx)\n",
+					frame + 1, frame + ran, chip.pc, reference.pc);
+				return 1;
+			}
+		}
+		if(shm != NULL){
+			chip8_shm_publish(shm, &chip, frame + ran);
+			wait_frame(&next);
+		}
+	}
+
+	if(capture != NULL){
+		chip8_set_frame_callback(NULL, NULL);
+		chip8_capture_close(capture, &stats);
+		fprintf(stderr, "%lu frames, %lu distinct, %lu dropped\n", stats.frames, stats.distinct, stats.dropped);
+	}
+	if(fuse != NULL){
+		fprintf(stderr, "%lu instructions, %lu superinstructions%s\n", fuse->instructions, fuse->fused,
+			verify ? ", same as one instruction at a time" : "");
+		free(fuse);
+	}
+	if(profile != NULL){
+		if(!chip8_profile_write(profile, profile_path)){
+			fprintf(stderr, "Error: Unable to write profile to %s\n", profile_path);
+			return 1;
+		}
+		chip8_profile_free(profile);
+	}
+	if(shm != NULL)
+		chip8_shm_close(shm, shm_name, 1);
+	chip8_cleanup(&chip);
+	return 0;
+}
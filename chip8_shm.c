@@ -0,0 +1,105 @@
+#define _POSIX_C_SOURCE 200112L
+#include "chip8_shm.h"
+#include <fcntl.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/* attempts to get a consistent copy before chip8_shm_read gives up */
+#define READ_ATTEMPTS	16
+
+static chip8_shm_t* map(const char* name, int flags){
+	chip8_shm_t* shm;
+	int fd = shm_open(name, flags, 0644);
+	if(fd < 0)
+		return NULL;
+	if((flags & O_CREAT) && ftruncate(fd, sizeof(chip8_shm_t)) != 0){
+		close(fd);
+		return NULL;
+	}
+	shm = mmap(NULL, sizeof(chip8_shm_t), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	close(fd);
+	return shm == MAP_FAILED ? NULL : shm;
+}
+
+chip8_shm_t* chip8_shm_create(const char* name){
+	chip8_shm_t* shm = map(name, O_CREAT | O_RDWR);
+	if(shm == NULL)
+		return NULL;
+	memset(shm, 0, sizeof(chip8_shm_t));
+	shm->version = CHIP8_SHM_VERSION;
+	shm->core_pid = (long)getpid();
+	/* viewers check magic last */
+	__sync_synchronize();
+	shm->magic = CHIP8_SHM_MAGIC;
+	return shm;
+}
+
+chip8_shm_t* chip8_shm_attach(const char* name){
+	chip8_shm_t* shm = map(name, O_RDWR);
+	if(shm == NULL)
+		return NULL;
+	if(shm->magic != CHIP8_SHM_MAGIC || shm->version != CHIP8_SHM_VERSION){
+		munmap(shm, sizeof(chip8_shm_t));
+		return NULL;
+	}
+	__sync_fetch_and_add(&shm->viewers, 1);
+	return shm;
+}
+
+void chip8_shm_publish(chip8_shm_t* shm, chip8_t* chip, unsigned long cycles){
+	/* odd sequence tells readers the frame is being written */
+	shm->sequence++;
+	__sync_synchronize();
+	memcpy(shm->frame.gfx, chip->gfx, sizeof(shm->frame.gfx));
+	shm->frame.delay_timer = chip->delay_timer;
+	shm->frame.sound_timer = chip->sound_timer;
+	shm->frame.waiting_keypress = chip->waiting_keypress == 1;
+	shm->frame.frames++;
+	shm->frame.cycles = cycles;
+	__sync_synchronize();
+	shm->sequence++;
+}
+
+int chip8_shm_read(chip8_shm_t* shm, chip8_shm_frame_t* out){
+	/* a copy which may be torn never reaches out */
+	chip8_shm_frame_t copy;
+	unsigned long before, after;
+	int attempt;
+	for(attempt = 0; attempt < READ_ATTEMPTS; ++attempt){
+		before = shm->sequence;
+		if(before & 1)
+			continue;
+		__sync_synchronize();
+		memcpy(&copy, &shm->frame, sizeof(chip8_shm_frame_t));
+		__sync_synchronize();
+		after = shm->sequence;
+		if(before == after){
+			*out = copy;
+			return 1;
+		}
+	}
+	return 0;
+}
+
+void chip8_shm_apply_keys(chip8_shm_t* shm, chip8_t* chip){
+	unsigned char i, down;
+	for(i = 0; i < CHIP_KEYS_COUNT; ++i){
+		down = shm->keys[i] != 0;
+		/* a new key press finishes Fx0A, same as in chipm8 */
+		if(down && !chip->keys[i] && chip->waiting_keypress == 1){
+			chip->last_pressed = i;
+			chip->waiting_keypress = 2;
+		}
+		chip->keys[i] = down;
+	}
+}
+
+void chip8_shm_close(chip8_shm_t* shm, const char* name, int owner){
+	if(!owner)
+		__sync_fetch_and_sub(&shm->viewers, 1);
+	munmap(shm, sizeof(chip8_shm_t));
+	if(owner)
+		shm_unlink(name);
+}
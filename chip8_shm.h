@@ -0,0 +1,68 @@
+#ifndef __CHIP8_SHM_H__
+#define __CHIP8_SHM_H__
+
+#include "chip8.h"
+
+/*
+ * Shared memory protocol between a core process and any number of viewers.
+ *
+ * The core publishes a frame (screen, timers, counters) into a POSIX shared
+ * memory object once per frame. Publishing is guarded by a sequence lock:
+ * the core never waits for anybody, a viewer copies the frame and retries if
+ * the sequence number changed meanwhile. A slow or crashed viewer can't stall
+ * the core, it just misses frames.
+ *
+ * Viewers report pressed keys by writing keys[] directly, the core picks them
+ * up once per frame (chip8_shm_apply_keys).
+ */
+
+#define CHIP8_SHM_MAGIC		0x43384D53UL
+#define CHIP8_SHM_VERSION	1
+
+/* state published by the core */
+typedef struct {
+	/* graphics memory, same layout as chip8_t.gfx */
+	unsigned char gfx[CHIP_GFX_WIDTH * CHIP_GFX_HEIGHT];
+	unsigned char delay_timer;
+	unsigned char sound_timer;
+	/* 1 if the machine is waiting for a key press */
+	unsigned char waiting_keypress;
+	/* frames published so far */
+	unsigned long frames;
+	/* cycles executed so far */
+	unsigned long cycles;
+} chip8_shm_frame_t;
+
+typedef struct {
+	unsigned long magic;
+	unsigned long version;
+	/* process id of the core */
+	long core_pid;
+	/* odd while the core is writing the frame */
+	volatile unsigned long sequence;
+	chip8_shm_frame_t frame;
+	/* number of attached viewers (informative - a crashed viewer is never subtracted) */
+	volatile unsigned long viewers;
+	/* key state written by viewers, 1 = pressed */
+	volatile unsigned char keys[CHIP_KEYS_COUNT];
+} chip8_shm_t;
+
+/* creates the shared memory object (core side), returns NULL on failure */
+chip8_shm_t* chip8_shm_create(const char* name);
+
+/* attaches to an existing object (viewer side), returns NULL on failure */
+chip8_shm_t* chip8_shm_attach(const char* name);
+
+/* publishes the machine's state (core side) */
+void chip8_shm_publish(chip8_shm_t* shm, chip8_t* chip, unsigned long cycles);
+
+/* copies latest consistent frame (viewer side). returns 0 and leaves out as it was if the core kept writing, try again later */
+int chip8_shm_read(chip8_shm_t* shm, chip8_shm_frame_t* out);
+
+/* copies keys reported by viewers into the machine (core side) */
+void chip8_shm_apply_keys(chip8_shm_t* shm, chip8_t* chip);
+
+/* detaches from the object. owner is 1 in the core, which removes it */
+void chip8_shm_close(chip8_shm_t* shm, const char* name, int owner);
+
+#endif
@@ -1,6 +1,12 @@
 #include <stdio.h>
+#include <string.h>
 #include <SDL2/SDL.h>
 #include "chip8.h"
+#include "chip8_compact.h"
+#include "chip8_cpu.h"
+#include "chip8_debug.h"
+#include "chip8_quirks.h"
+#include "chip8_shm.h"
 
 /* window dimensions */
 #define SCREEN_WIDTH 10 * CHIP_GFX_WIDTH
@@ -29,9 +35,90 @@ static int 	mpitch;
 
 /* the chip */
 static chip8_t chip;
+/* core running in another process (-attach), NULL if the chip runs here */
+static chip8_shm_t* shm = NULL;
+static chip8_shm_frame_t shm_frame;
+/* frames shown ahead of the machine (-runahead) and the state they're run from. memory isn't
+ * copied with the rest, the store handlers save a page just before it's first written */
+static int runahead = 0;
+static chip8_t snapshot;
+static int running_ahead = 0;
+static unsigned char saved_pages[CHIP8_PAGE_COUNT][CHIP8_PAGE_SIZE];
+static unsigned char page_saved[CHIP8_PAGE_COUNT];
+static unsigned short saved[CHIP8_PAGE_COUNT];
+static size_t saved_count = 0;
+/* machines shown in a grid (-grid), NULL if there's just the chip */
+static chip8_t* machines = NULL;
+static int grid_columns = 1, grid_rows = 1;
+/* pixels of the whole grid, only tiles of machines whose screen changed are redrawn */
+static unsigned int* atlas;
+static unsigned long* tile_hashes;
+static int atlas_drawn = 0;
 
 /* this function will send pixels from chip to SDL */
-void sync_screen();
+void sync_screen(unsigned char* gfx);
+
+/* sends screens of the grid's machines to SDL */
+void sync_grid(void);
+
+static void press(chip8_t* target, unsigned char key, unsigned char down){
+	target->keys[key] = down;
+	if(down && target->waiting_keypress == 1){
+		target->last_pressed = key;
+		target->waiting_keypress = 2;
+	}
+}
+
+/* bytes of memory in the page, the last one is only as long as the guard */
+static size_t page_length(unsigned short number){
+	size_t offset = (size_t)number * CHIP8_PAGE_SIZE;
+	return sizeof(chip.memory) - offset < CHIP8_PAGE_SIZE ? sizeof(chip.memory) - offset : CHIP8_PAGE_SIZE;
+}
+
+static void save_page(unsigned short number){
+	if(page_saved[number])
+		return;
+	memcpy(saved_pages[number], chip.memory + number * CHIP8_PAGE_SIZE, page_length(number));
+	page_saved[number] = 1;
+	saved[saved_count++] = number;
+}
+
+/* Fx33, Fx55 - they write at most 16 bytes from I, so at most two pages */
+static void store_handler(chip8_t* target, opcode_params_t* params){
+	if(running_ahead){
+		save_page(target->I / CHIP8_PAGE_SIZE);
+		save_page(((unsigned long)target->I + CHIP_ADDRESS_GUARD - 1) / CHIP8_PAGE_SIZE);
+	}
+	chip8_call_wrapped(store_handler, target, params);
+}
+
+/* rewinds the chip to the snapshot */
+static void restore(void){
+	size_t i;
+	for(i = 0; i < saved_count; ++i){
+		memcpy(chip.memory + saved[i] * CHIP8_PAGE_SIZE, saved_pages[saved[i]], page_length(saved[i]));
+		page_saved[saved[i]] = 0;
+	}
+	saved_count = 0;
+	chip8_copy_state(&chip, &snapshot);
+}
+
+/* presses or releases a chip key */
+static void set_key(unsigned char key, unsigned char down){
+	int i;
+	if(shm != NULL){
+		/* the core picks it up at the next frame */
+		shm->keys[key] = down;
+		return;
+	}
+	if(machines != NULL){
+		/* every machine in the grid gets the same keys */
+		for(i = 0; i < grid_columns * grid_rows; ++i)
+			press(&machines[i], key, down);
+		return;
+	}
+	press(&chip, key, down);
+}
 
 /* loads program from file */
 size_t load_program(char* filename, unsigned char* whereToLoad){
@@ -44,12 +131,18 @@ size_t load_program(char* filename, unsigned char* whereToLoad){
 }
 
 int main(int argc, char** argv){
-	if(argc < 2){
-		fprintf(stderr, "Please specify a filename");
+	if(argc < 2 || (strcmp(argv[1], "-attach") == 0 && argc < 3)){
+		fprintf(stderr, "Please specify a filename\nusage: %s <rom> [-d] [-quirks default|vip|schip|modern] [-runahead n] [-grid <columns>x<rows>]\n       %s -attach <shm name>\n", argv[0], argv[0]);
 		return 1;
 	}
-	unsigned char* program = malloc(512 * sizeof(char));
-	size_t program_length = load_program(argv[1], program);
+	/* -attach shows a core which runs in another process (chip8_run -shm) */
+	if(strcmp(argv[1], "-attach") == 0){
+		shm = chip8_shm_attach(argv[2]);
+		if(shm == NULL){
+			fprintf(stderr, "Error: Unable to attach to %s", argv[2]);
+			return 1;
+		}
+	}
 
 	/* initialize SDL */
 	if(SDL_Init(SDL_INIT_EVERYTHING) != 0){
@@ -68,13 +161,82 @@ int main(int argc, char** argv){
 		fprintf(stderr, "Error: Unable to create renderer: %s", SDL_GetError());
 		return 1;
 	}
-	screen = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_STREAMING, CHIP_GFX_WIDTH, CHIP_GFX_HEIGHT);
-	/* initialize the chip */
-	chip8_init(&chip);
-	chip8_load(&chip, program, program_length);
-	/* after we've loaded from the program, we can free the memory */
-	free(program);
+	if(shm == NULL){
+		unsigned char* program = malloc(512 * sizeof(char));
+		size_t program_length = load_program(argv[1], program);
+		int i;
+		/* initialize the chip */
+		chip8_init(&chip);
+		chip8_load(&chip, program, program_length);
+		/* after we've loaded from the program, we can free the memory */
+		free(program);
+		for(i = 2; i < argc; ++i){
+			if(strcmp(argv[i], "-quirks") == 0 && i + 1 < argc){
+				/* handlers of the profile have to be in place before the debugger wraps them */
+				if(!chip8_select_quirks(chip8_quirks_by_name(argv[++i]))){
+					fprintf(stderr, "Error: Unknown quirk profile %s", argv[i]);
+					return 1;
+				}
+			} else if(strcmp(argv[i], "-runahead") == 0 && i + 1 < argc){
+				runahead = atoi(argv[++i]);
+			} else if(strcmp(argv[i], "-grid") == 0 && i + 1 < argc){
+				/* the atlas has to fit into a texture */
+				if(sscanf(argv[++i], "%dx%d", &grid_columns, &grid_rows) != 2 || grid_columns < 1 || grid_rows < 1
+						|| grid_columns * CHIP_GFX_WIDTH > 4096 || grid_rows * CHIP_GFX_HEIGHT > 4096){
+					fprintf(stderr, "Error: Invalid grid %s", argv[i]);
+					return 1;
+				}
+			}
+		}
+		if(grid_columns * grid_rows > 1){
+			int n = grid_columns * grid_rows;
+			machines = malloc(n * sizeof(chip8_t));
+			atlas = malloc(n * CHIP_GFX_WIDTH * CHIP_GFX_HEIGHT * sizeof(unsigned int));
+			tile_hashes = malloc(n * sizeof(unsigned long));
+			if(machines == NULL || atlas == NULL || tile_hashes == NULL){
+				fprintf(stderr, "Error: Unable to allocate %d machines", n);
+				return 1;
+			}
+			for(i = 0; i < n; ++i){
+				machines[i] = chip;
+				/* same program, but each machine gets different random numbers */
+				machines[i].random = i + 1;
+			}
+			/* run-ahead is for playing a single machine */
+			runahead = 0;
+		}
+		/* -d stops in the debugger before the first instruction */
+		for(i = 2; i < argc; ++i){
+			if(strcmp(argv[i], "-d") == 0){
+				chip8_debug_step();
+				/* the debugger would stop in frames which are thrown away */
+				runahead = 0;
+			}
+		}
+		/* stores save the pages they're about to write while the chip runs ahead (the grid has no run-ahead) */
+		if(runahead > 0 && (!chip8_wrap_handlers(0xF0FF, 0xF033, store_handler)
+				|| !chip8_wrap_handlers(0xF0FF, 0xF055, store_handler))){
+			fprintf(stderr, "Error: Unable to wrap handlers");
+			return 1;
+		}
+	}
 	
+	screen = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_STREAMING,
+		CHIP_GFX_WIDTH * grid_columns, CHIP_GFX_HEIGHT * grid_rows);
+	if(grid_columns * grid_rows > 1){
+		/* the grid keeps the scale of a single screen, as far as it fits on the display */
+		SDL_DisplayMode display;
+		int scale = SCREEN_WIDTH / CHIP_GFX_WIDTH;
+		if(SDL_GetDesktopDisplayMode(0, &display) == 0){
+			while(scale > 1 && (scale * CHIP_GFX_WIDTH * grid_columns > display.w
+					|| scale * CHIP_GFX_HEIGHT * grid_rows > display.h))
+				--scale;
+		}
+		SDL_SetWindowSize(window, scale * CHIP_GFX_WIDTH * grid_columns, scale * CHIP_GFX_HEIGHT * grid_rows);
+	}
+	/* letterboxed rather than stretched when the window manager doesn't give us that size */
+	SDL_RenderSetLogicalSize(renderer, CHIP_GFX_WIDTH * grid_columns, CHIP_GFX_HEIGHT * grid_rows);
+
 	int running = 1;
 	unsigned time = 0, now = 0, tickTime = 0;
 	while(running){
@@ -86,21 +248,17 @@ int main(int argc, char** argv){
 					running = 0;
 				} else {
 					unsigned char i;
-					for(i = 0; i < sizeof(bindings); ++i){
+					for(i = 0; i < sizeof(bindings) / sizeof(bindings[0]); ++i){
 						if(event.key.keysym.sym == bindings[i].sdl_key){
-							chip.keys[bindings[i].chip_key] = 1;
-							if(chip.waiting_keypress == 1){
-								chip.last_pressed = bindings[i].chip_key;
-								chip.waiting_keypress = 2;
-							}
+							set_key(bindings[i].chip_key, 1);
 						}
 					}
 				}
 			} else if(event.type == SDL_KEYUP){
 				unsigned char i;
-				for(i = 0; i < sizeof(bindings); ++i){
+				for(i = 0; i < sizeof(bindings) / sizeof(bindings[0]); ++i){
 					if(event.key.keysym.sym == bindings[i].sdl_key){
-						chip.keys[bindings[i].chip_key] = 0;
+						set_key(bindings[i].chip_key, 0);
 					}
 				}
 			} else if(event.type == SDL_QUIT){
@@ -108,23 +266,55 @@ int main(int argc, char** argv){
 			} /* else, do nothing */
 		}
 		
-		/* do one cycle on chip */
-		chip8_cycle(&chip);
-		
-
 		/* draw the current screen */
 		SDL_RenderClear(renderer);
-		sync_screen();
+		if(shm != NULL){
+			/* if the core is just writing, the previous frame stays on the texture */
+			if(chip8_shm_read(shm, &shm_frame))
+				sync_screen(shm_frame.gfx);
+		} else if(machines != NULL){
+			int n;
+			for(n = 0; n < grid_columns * grid_rows; ++n)
+				chip8_cycle(&machines[n]);
+			sync_grid();
+		} else {
+			int ahead;
+			/* do one cycle on chip */
+			chip8_cycle(&chip);
+			if(runahead > 0){
+				/* show where the current keys lead a few frames later, then rewind */
+				chip8_copy_state(&snapshot, &chip);
+				running_ahead = 1;
+				for(ahead = 0; ahead < runahead; ++ahead)
+					chip8_cycle(&chip);
+				running_ahead = 0;
+				sync_screen(chip.gfx);
+				restore();
+			} else {
+				sync_screen(chip.gfx);
+			}
+		}
 		SDL_RenderCopy(renderer, screen, NULL, NULL);
 		SDL_RenderPresent(renderer);
 		
-		/* ensure delay <= 60 Hz */
+		/* ensure delay <= 60 Hz, a frame which took longer (a large -grid) isn't delayed at all */
 		now = SDL_GetTicks();
 		tickTime = now - time;
-		SDL_Delay(1000 / 60 - tickTime); 
+		if(tickTime < 1000 / 60)
+			SDL_Delay(1000 / 60 - tickTime);
 	}
 	/* Free memory */
-	chip8_cleanup(&chip);
+	if(shm != NULL){
+		chip8_shm_close(shm, argv[2], 0);
+	} else {
+		chip8_debug_cleanup();
+		chip8_cleanup(&chip);
+		if(machines != NULL){
+			free(machines);
+			free(atlas);
+			free(tile_hashes);
+		}
+	}
 	SDL_DestroyTexture(screen);
 	SDL_DestroyRenderer(renderer);
 	SDL_DestroyWindow(window);
@@ -143,10 +333,61 @@ int get_color(unsigned char pixel){
 }
 
 static int i = 0;
-void sync_screen(){
+void sync_screen(unsigned char* gfx){
 	SDL_LockTexture(screen, NULL, &mpixels, &mpitch);
 	for(i = 0; i < CHIP_GFX_WIDTH * CHIP_GFX_HEIGHT; ++i){
-		*((int*)(mpixels) + i) = get_color(chip.gfx[i]);
+		*((int*)(mpixels) + i) = get_color(gfx[i]);
 	}
 	SDL_UnlockTexture(screen);
 }
+
+/* FNV-1a */
+static unsigned long hash_gfx(const unsigned char* gfx){
+	unsigned long h = 2166136261UL;
+	int n;
+	for(n = 0; n < CHIP_GFX_WIDTH * CHIP_GFX_HEIGHT; ++n){
+		h ^= gfx[n];
+		h = (h * 16777619UL) & 0xFFFFFFFFUL;
+	}
+	return h;
+}
+
+void sync_grid(void){
+	int width = CHIP_GFX_WIDTH * grid_columns;
+	int n, x, y, column, row;
+	int left = grid_columns, right = -1, top = grid_rows, bottom = -1;
+	unsigned long h;
+	unsigned int* tile;
+	SDL_Rect dirty;
+
+	for(n = 0; n < grid_columns * grid_rows; ++n){
+		h = hash_gfx(machines[n].gfx);
+		if(atlas_drawn && h == tile_hashes[n])
+			continue;
+		tile_hashes[n] = h;
+		column = n % grid_columns;
+		row = n / grid_columns;
+		tile = atlas + row * CHIP_GFX_HEIGHT * width + column * CHIP_GFX_WIDTH;
+		for(y = 0; y < CHIP_GFX_HEIGHT; ++y){
+			for(x = 0; x < CHIP_GFX_WIDTH; ++x)
+				tile[y * width + x] = get_color(machines[n].gfx[y * CHIP_GFX_WIDTH + x]);
+		}
+		if(column < left)
+			left = column;
+		if(column > right)
+			right = column;
+		if(row < top)
+			top = row;
+		if(row > bottom)
+			bottom = row;
+	}
+	atlas_drawn = 1;
+	if(right < 0)
+		return;
+	/* one upload of the rectangle around the changed tiles */
+	dirty.x = left * CHIP_GFX_WIDTH;
+	dirty.y = top * CHIP_GFX_HEIGHT;
+	dirty.w = (right - left + 1) * CHIP_GFX_WIDTH;
+	dirty.h = (bottom - top + 1) * CHIP_GFX_HEIGHT;
+	SDL_UpdateTexture(screen, &dirty, atlas + dirty.y * width + dirty.x, width * sizeof(unsigned int));
+}